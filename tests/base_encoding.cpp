@@ -0,0 +1,32 @@
+#include <uninttp/base_encoding.hpp>
+#include <algorithm>
+#include <cassert>
+#include <string_view>
+
+using namespace uninttp;
+
+/* Whether the bytes held by `Value` spell `expected` */
+template <uni_auto Value>
+constexpr bool spells(const std::string_view expected) {
+    return Value.size() == expected.size()
+        && std::equal(expected.begin(), expected.end(), Value.data(), [](const char c, const std::byte b) { return static_cast<std::byte>(c) == b; });
+}
+
+static_assert(spells<hex_v<"deadBEEF">>("\xDE\xAD\xBE\xEF"));
+static_assert(spells<hex_v<"00 ff\n10">>(std::string_view { "\x00\xFF\x10", 3 }));
+
+// The RFC 4648 test vectors, with and without padding
+static_assert(spells<base64_v<"Zg==">>("f") && spells<base64_v<"Zm8=">>("fo") && spells<base64_v<"Zm9v">>("foo"));
+static_assert(spells<base64_v<"Zm9vYmFy">>("foobar") && spells<base64_v<"Zm9vYg">>("foob"));
+static_assert(spells<base32_v<"MY======">>("f") && spells<base32_v<"MZXW6===">>("foo") && spells<base32_v<"MZXW6YTBOI======">>("foobar"));
+static_assert(spells<base32_v<"MZXW6YQ">>("foob"));
+
+// Both base64 alphabets decode the same way
+static_assert(spells<base64_v<"+/+/">>("\xFB\xFF\xBF") && spells<base64_v<"-_-_">>("\xFB\xFF\xBF"));
+
+int main() {
+    // The decoded bytes live in an ordinary constant array
+    constexpr auto key = hex_v<"000102030405060708090a0b0c0d0e0f">;
+    for (std::size_t i = 0; i < key.size(); i++)
+        assert(key.data()[i] == static_cast<std::byte>(i));
+}
@@ -0,0 +1,66 @@
+#include <uninttp/binary_layout.hpp>
+#include <cassert>
+#include <vector>
+
+using namespace uninttp;
+
+enum class kind : std::uint16_t { add = 0x0102, remove = 0x0304 };
+
+struct header {
+    std::uint32_t length;
+    std::uint16_t type;
+    kind k;
+    std::uint8_t flags[2];
+    std::int16_t grid[2][2];
+    double price;
+    std::array<std::uint32_t, 2> ids;
+};
+
+// `length`, `type`, `k` and `flags` lie next to each other, `price` and `ids` too; `grid` is left out
+using full = binary_layout<&header::length, &header::type, &header::k, &header::flags, &header::price, &header::ids>;
+using shuffled = binary_layout<&header::type, &header::length, &header::grid>;
+
+static_assert(full::size == 4 + 2 + 2 + 2 + 8 + 8);
+static_assert(full::copy_count() == 2);
+static_assert(shuffled::size == 2 + 4 + 8 && shuffled::copy_count() == 3);
+
+template <typename... Bytes>
+static std::vector<std::byte> bytes(const Bytes... b) {
+    return { static_cast<std::byte>(b)... };
+}
+
+int main() {
+    const header h{ 0x11223344, 0x5566, kind::remove, { 0xAA, 0xBB }, { { 1, -2 }, { 0x0304, -1 } }, 1.0, { 0x01020304, 0x0A0B0C0D } };
+
+    // Both byte orders, whatever the native one is
+    {
+        std::vector<std::byte> out(full::size);
+        assert(full::write(out.data(), h) == out.data() + out.size());
+        assert(out == bytes(0x44, 0x33, 0x22, 0x11, 0x66, 0x55, 0x04, 0x03, 0xAA, 0xBB, 0, 0, 0, 0, 0, 0, 0xF0, 0x3F,
+                            0x04, 0x03, 0x02, 0x01, 0x0D, 0x0C, 0x0B, 0x0A));
+        full::write<std::endian::big>(out.data(), h);
+        assert(out == bytes(0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x03, 0x04, 0xAA, 0xBB, 0x3F, 0xF0, 0, 0, 0, 0, 0, 0,
+                            0x01, 0x02, 0x03, 0x04, 0x0A, 0x0B, 0x0C, 0x0D));
+    }
+    {
+        std::vector<std::byte> out(shuffled::size);
+        shuffled::write<std::endian::big>(out.data(), h);
+        assert(out == bytes(0x55, 0x66, 0x11, 0x22, 0x33, 0x44, 0, 1, 0xFF, 0xFE, 0x03, 0x04, 0xFF, 0xFF));
+    }
+
+    // Round trips, which leave the members that aren't part of the layout alone
+    const auto round_trip = [&]<typename Layout, std::endian Order>() {
+        std::vector<std::byte> out(Layout::size);
+        Layout::template write<Order>(out.data(), h);
+        header back{};
+        back.grid[1][1] = 7;
+        assert(Layout::template read<Order>(out.data(), back) == out.data() + out.size());
+        return back;
+    };
+    for (const auto& back : { round_trip.operator()<full, std::endian::little>(), round_trip.operator()<full, std::endian::big>() }) {
+        assert(back.length == h.length && back.type == h.type && back.k == kind::remove && back.flags[0] == 0xAA && back.flags[1] == 0xBB);
+        assert(back.price == 1.0 && back.ids == h.ids && back.grid[1][1] == 7);
+    }
+    for (const auto& back : { round_trip.operator()<shuffled, std::endian::little>(), round_trip.operator()<shuffled, std::endian::big>() })
+        assert(back.length == h.length && back.type == h.type && back.grid[0][1] == -2 && back.grid[1][0] == 0x0304 && back.grid[1][1] == -1);
+}
@@ -0,0 +1,62 @@
+#include <uninttp/config.hpp>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+using namespace uninttp;
+
+enum class level : std::uint8_t { quiet, normal, loud };
+
+struct settings {
+    int threads = 1;
+    bool verbose = false;
+    double ratio = 0.5;
+    std::int8_t offset = 0;
+    level log_level = level::normal;
+    char name[16] {};
+    int ports[3] {};
+    std::array<double, 2> weights {};
+};
+
+template <uni_auto Json>
+constexpr auto parse = config_v<Json,
+                                field<"threads", &settings::threads>,
+                                field<"verbose", &settings::verbose>,
+                                field<"ratio", &settings::ratio>,
+                                field<"offset", &settings::offset>,
+                                field<"level", &settings::log_level>,
+                                field<"name", &settings::name>,
+                                field<"ports", &settings::ports>,
+                                field<"weights", &settings::weights>>;
+
+// Absent keys keep their default member initializers
+constexpr auto defaults = parse<"{}">;
+static_assert(defaults.threads == 1 && !defaults.verbose && defaults.ratio == 0.5 && defaults.log_level == level::normal);
+
+constexpr auto full = parse<R"(
+    {
+        "threads": 8, "verbose": true, "ratio": -1.25e-2, "offset": -128, "level": 2,
+        "name": "in\"gest\\\n", "ports": [80, 443], "weights": [1e3, 0.25]
+    }
+)">;
+static_assert(full.threads == 8 && full.verbose && full.ratio == -1.25e-2 && full.offset == -128 && full.log_level == level::loud);
+static_assert(std::string_view { full.name } == "in\"gest\\\n");
+static_assert(full.ports[0] == 80 && full.ports[1] == 443 && full.ports[2] == 0);
+static_assert(full.weights[0] == 1000 && full.weights[1] == 0.25);
+
+// Escapes, including \u sequences (encoded as UTF-8) and surrogate pairs
+static_assert(std::string_view { parse<R"({ "name": "é😀\t" })">.name } == "\xC3\xA9\xF0\x9F\x98\x80\t");
+static_assert(std::string_view { parse<R"({ "name": "\u0041\u00e9\u20AC\ud83d\ude00\uD834\uDD1E" })">.name } == "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xF0\x9D\x84\x9E");
+// (An unpaired surrogate, as in "\ud83d", "\ud83dx", "\ud83d\u0041" or "\ude00", doesn't compile.)
+
+// Members can be read into a class passed on as a template argument
+template <settings S>
+constexpr auto thread_count = S.threads;
+static_assert(thread_count<parse<R"({ "threads": 3 })">> == 3);
+
+int main() {
+    // The parsed object is an ordinary constant, usable at runtime as it is
+    auto copy = full;
+    copy.threads++;
+    assert(copy.threads == 9 && std::string_view { copy.name }.size() == 9);
+}
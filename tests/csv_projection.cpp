@@ -0,0 +1,92 @@
+#include <uninttp/csv_projection.hpp>
+#include <cassert>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace uninttp;
+
+using row = std::tuple<long, std::string, int>;
+
+static_assert(csv_projection<"ts", "sym", "qty">::size() == 3);
+
+// Quoted fields with delimiters, line breaks and doubled quotes, CRLF line ends, an empty line, and trailing columns holding quoted line breaks that have to be skipped over
+constexpr std::string_view records = "1,\"A,B\",x,10,\"tail\nstill tail\"\r\n"
+                                     "\n"
+                                     "2,\"say \"\"hi\"\"\",y,-3\n"
+                                     "3,\"multi\nline\",z,7,\"a\"\"b\",more\n"
+                                     "4,plain,w,0";
+
+static std::vector<row> read_in_two(csv_projection<"ts", "sym", "qty">& projection, const std::string_view first, const std::string_view second) {
+    std::vector<row> rows;
+    const auto collect = [&](const long ts, const std::string_view sym, const int qty) { rows.emplace_back(ts, sym, qty); };
+    const auto [end, ec] = projection.feed(first, collect);
+    assert(ec == std::errc{});
+    const auto carried = std::string(end, first.data() + first.size()) + std::string(second);
+    const auto [final_end, final_ec] = projection.feed(carried, collect, true);
+    assert(final_ec == std::errc{} && final_end == carried.data() + carried.size());
+    return rows;
+}
+
+int main() {
+    // Columns are found wherever they are in the header, which may arrive in pieces
+    csv_projection<"ts", "sym", "qty"> projection;
+    {
+        const std::string_view header = "ts,sym,\"venue\",qty,note\n";
+        assert(projection.header(header.substr(0, 9)).ptr == header.data() && projection.header(header.substr(0, 9)).ec == std::errc{});
+        const auto [end, ec] = projection.header(header);
+        assert(ec == std::errc{} && end == header.data() + header.size());
+        assert(projection.column(0) == 0 && projection.column(1) == 1 && projection.column(2) == 3);
+    }
+
+    const std::vector<row> expected { { 1, "A,B", 10 }, { 2, "say \"\"hi\"\"", -3 }, { 3, "multi\nline", 7 }, { 4, "plain", 0 } };
+
+    // Every split point gives the same records, with the unfinished one carried over
+    for (std::size_t split = 0; split <= records.size(); split++)
+        assert(read_in_two(projection, records.substr(0, split), records.substr(split)) == expected);
+
+    // A record that ends at the end of a chunk that isn't final stays unread
+    {
+        std::size_t calls = 0;
+        const auto [end, ec] = projection.feed("5,a,b,1", [&](long, std::string_view, int) { calls++; });
+        assert(ec == std::errc{} && calls == 0 && std::string_view(end) == "5,a,b,1");
+    }
+
+    // Raw text when the callback takes string_views, and stopping early when it returns false
+    {
+        std::vector<std::string_view> seen;
+        const std::string_view chunk = "9,\"q\"\"\",v,x\n10,b,v,y\n";
+        const auto [end, ec] = projection.feed(chunk, [&](const std::string_view ts, const std::string_view sym, const std::string_view qty) {
+            seen.insert(seen.end(), { ts, sym, qty });
+            return false;
+        });
+        assert(ec == std::errc{} && std::string_view(end) == "10,b,v,y\n");
+        assert((seen == std::vector<std::string_view> { "9", "q\"\"", "x" }));
+    }
+
+    // Other conversions
+    {
+        csv_projection<"on", "px"> flags;
+        assert(flags.header("px,on\r\n", true).ec == std::errc{});
+        std::vector<std::pair<bool, double>> got;
+        assert(flags.feed("1.5,true\r\n-2,0\r\n", [&](const bool on, const double px) { got.emplace_back(on, px); }, true).ec == std::errc{});
+        assert((got == std::vector<std::pair<bool, double>> { { true, 1.5 }, { false, -2 } }));
+        assert(flags.feed("1,yes\n", [](bool, double) {}, true).ec == std::errc::invalid_argument);
+    }
+
+    // Errors point at the start of the offending record
+    {
+        const auto noop = [](long, std::string_view, int) {};
+        const std::string_view bad_value = "1,a,b,2\n2,a,b,2x\n";
+        assert(projection.feed(bad_value, noop).ptr == bad_value.data() + 8 && projection.feed(bad_value, noop).ec == std::errc::invalid_argument);
+        assert(projection.feed("1,a,b,99999999999\n", noop).ec == std::errc::result_out_of_range);
+        assert(projection.feed("1,a,b\n", noop).ec == std::errc::invalid_argument);           // Lacks a column
+        assert(projection.feed("1,a\"b,c,2\n", noop).ec == std::errc::invalid_argument);      // Stray quote
+        assert(projection.feed("1,\"a\"b,c,2\n", noop).ec == std::errc::invalid_argument);    // Text after a closing quote
+        assert(projection.feed("1,\"ab,c,2\n", noop, true).ec == std::errc::invalid_argument); // Unterminated quote
+    }
+
+    // A header without one of the columns is rejected
+    csv_projection<"ts", "missing"> incomplete;
+    assert(incomplete.header("ts,sym\n").ec == std::errc::invalid_argument);
+}
@@ -0,0 +1,170 @@
+#include <uninttp/enum_array.hpp>
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace uninttp;
+
+enum class order_state { pending = 1, filled = 4, cancelled = 9, expired = 100 };
+
+enum class color : std::uint8_t { red, green, blue };
+
+enum class delta : std::int8_t { minus_two = -2, minus_one, zero, one };
+
+enum class sparse : std::int64_t { low = -(std::int64_t{ 1 } << 40), neg = -7, a = 3, b = 1000, high = std::int64_t{ 1 } << 50 };
+
+enum class wide : std::uint16_t {};
+
+// No mapping: the values run from 0 on (in whatever order they're given)
+using by_color = enum_array<int, color::blue, color::red, color::green>;
+
+static_assert(by_color::keys == std::array { color::red, color::green, color::blue });
+static_assert(by_color::index(color::red) == 0 && by_color::index(color::green) == 1 && by_color::index(color::blue) == 2);
+static_assert(by_color::contains(color::blue) && !by_color::contains(static_cast<color>(3)) && !by_color::contains(static_cast<color>(255)));
+
+// A subtraction: the values run from elsewhere on, across 0 here
+using by_delta = enum_array<int, delta::one, delta::minus_two, delta::zero, delta::minus_one>;
+
+static_assert(by_delta::keys == std::array { delta::minus_two, delta::minus_one, delta::zero, delta::one });
+static_assert(by_delta::index(delta::minus_two) == 0 && by_delta::index(delta::one) == 3);
+static_assert(by_delta::contains(delta::zero) && !by_delta::contains(static_cast<delta>(-3)) && !by_delta::contains(static_cast<delta>(2)));
+static_assert(!by_delta::contains(static_cast<delta>(-128)) && !by_delta::contains(static_cast<delta>(127)));
+
+// A perfect hash: the values have gaps
+using per_state = enum_array<std::uint64_t, order_state::pending, order_state::filled, order_state::cancelled, order_state::expired>;
+
+static_assert(per_state::keys == std::array { order_state::pending, order_state::filled, order_state::cancelled, order_state::expired });
+static_assert(per_state::index(order_state::pending) == 0 && per_state::index(order_state::filled) == 1);
+static_assert(per_state::index(order_state::cancelled) == 2 && per_state::index(order_state::expired) == 3);
+
+template <typename Array, typename E>
+constexpr bool contains_only_keys(const std::intmax_t from, const std::intmax_t to) {
+    for (auto v = from; v <= to; v++) {
+        const auto k = static_cast<E>(v);
+        if (Array::contains(k) != (std::find(Array::keys.begin(), Array::keys.end(), k) != Array::keys.end()))
+            return false;
+    }
+    return true;
+}
+
+static_assert(contains_only_keys<per_state, order_state>(-1000, 1000));
+static_assert(contains_only_keys<by_color, color>(0, 255));
+static_assert(contains_only_keys<by_delta, delta>(-128, 127));
+
+using by_sparse = enum_array<char, sparse::high, sparse::a, sparse::low, sparse::b, sparse::neg>;
+
+static_assert(by_sparse::keys == std::array { sparse::low, sparse::neg, sparse::a, sparse::b, sparse::high });
+static_assert(by_sparse::index(sparse::low) == 0 && by_sparse::index(sparse::neg) == 1 && by_sparse::index(sparse::a) == 2);
+static_assert(by_sparse::index(sparse::b) == 3 && by_sparse::index(sparse::high) == 4);
+static_assert(contains_only_keys<by_sparse, sparse>(-2000, 2000));
+static_assert(!by_sparse::contains(static_cast<sparse>(std::int64_t{ 1 } << 40)) && !by_sparse::contains(static_cast<sparse>(-(std::int64_t{ 1 } << 50))));
+
+// Many keys spread out, which need more than a few bits of hash
+template <std::size_t... I>
+constexpr auto spread(std::index_sequence<I...>) {
+    return enum_array<std::size_t, static_cast<wide>(I * I * 13 + 5)...>{};
+}
+
+using by_wide = decltype(spread(std::make_index_sequence<40>{}));
+
+static_assert(by_wide::size() == 40);
+static_assert([] {
+    for (std::size_t i = 0; i < 40; i++)
+        if (by_wide::index(static_cast<wide>(i * i * 13 + 5)) != i)
+            return false;
+    return true;
+}());
+static_assert([] {
+    std::size_t n = 0;
+    for (std::size_t v = 0; v <= 0xFFFF; v++)
+        n += by_wide::contains(static_cast<wide>(v));
+    return n == 40 && std::all_of(by_wide::keys.begin(), by_wide::keys.end(), by_wide::contains);
+}());
+
+// Elements
+static_assert([] {
+    per_state a;
+    a[order_state::filled] = 3;
+    a[order_state::expired] += 2;
+    a.get<order_state::pending>() = 1;
+    const auto& c = a;
+    return c[order_state::filled] == 3 && c.get<order_state::expired>() == 2 && a.values == std::array<std::uint64_t, 4> { 1, 3, 0, 2 };
+}());
+
+static_assert([] {
+    by_sparse a, b;
+    a[sparse::b] = 'x';
+    b.get<sparse::b>() = 'x';
+    return a == b && !(a == by_sparse{});
+}());
+
+template <typename Array, auto Key>
+concept has_get = requires(Array a) { a.template get<Key>(); };
+
+static_assert(has_get<per_state, order_state::filled> && !has_get<per_state, static_cast<order_state>(5)>);
+static_assert(has_get<by_delta, delta::one> && !has_get<by_delta, static_cast<delta>(2)>);
+
+// Bits
+using terminal_set = enum_bitset<order_state::pending, order_state::filled, order_state::cancelled, order_state::expired>;
+
+static_assert([] {
+    terminal_set s;
+    if (s.any() || !s.none() || s.count() != 0)
+        return false;
+    s.set(order_state::cancelled).set(order_state::expired);
+    if (s.count() != 2 || !s.test(order_state::cancelled) || s.test(order_state::pending) || s.words[0] != 0b1100)
+        return false;
+    s.set(order_state::expired, false).reset(order_state::pending);
+    if (s.words[0] != 0b0100)
+        return false;
+    const auto inverse = ~s;
+    return inverse.words[0] == 0b1011 && (s | inverse).all() && (s & inverse).none() && (s ^ s).none() && (s ^ inverse) == ~terminal_set{};
+}());
+
+template <std::size_t... I>
+constexpr auto spread_set(std::index_sequence<I...>) {
+    return enum_bitset<static_cast<wide>(I * I * 13 + 5)...>{};
+}
+
+using wide_set = decltype(spread_set(std::make_index_sequence<70>{}));
+
+static_assert(wide_set::size() == 70 && sizeof(wide_set) == 16);
+
+static_assert([] {
+    const auto all = ~wide_set{};
+    return all.all() && all.count() == 70 && all.words[1] == 0b111111;
+}());
+
+int main() {
+    // Elements, at run time
+    per_state transitions;
+    volatile int v = 9;
+    transitions[static_cast<order_state>(v)]++;
+    transitions[order_state::filled] += 5;
+    std::uint64_t total = 0;
+    for (const auto n : transitions)
+        total += n;
+    assert(total == 6 && transitions.values[2] == 1 && transitions.values[1] == 5);
+    assert(!per_state::contains(static_cast<order_state>(v - 1)));
+
+    by_wide w;
+    for (std::size_t i = 0; i < 40; i++)
+        w[static_cast<wide>(i * i * 13 + 5)] = i;
+    for (std::size_t i = 0; i < 40; i++)
+        assert(w.values[i] == i);
+
+    // Bits across more than one word, visited in the order of the keys
+    wide_set s;
+    for (std::size_t i = 0; i < 70; i += 3)
+        s.set(static_cast<wide>(i * i * 13 + 5));
+    assert(s.count() == 24 && s.test(static_cast<wide>(69 * 69 * 13 + 5)) && !s.test(static_cast<wide>(68 * 68 * 13 + 5)));
+    std::vector<wide> visited;
+    s.for_each([&](const wide k) { visited.push_back(k); });
+    assert(visited.size() == 24);
+    for (std::size_t i = 0; i < visited.size(); i++)
+        assert(visited[i] == static_cast<wide>(3 * i * 3 * i * 13 + 5));
+    const auto rest = ~s;
+    assert(rest.count() == 46 && (rest & s).none() && (rest | s).all());
+    s.reset(static_cast<wide>(69 * 69 * 13 + 5));
+    assert(s.count() == 23 && s.words[1] == 0b000100);
+}
@@ -0,0 +1,100 @@
+#include <uninttp/enum_name.hpp>
+#include <cassert>
+#include <cstring>
+#include <string>
+
+using namespace uninttp;
+
+enum class order_state { pending = 1, filled = 4, cancelled = 9 };
+
+namespace venue {
+    enum code : std::int8_t { _hidden = -128, xnas = -3, arcx = 0, bats_2 = 7, edgx = 127 };
+}
+
+enum class side : std::uint8_t { buy, sell, both = 255 };
+
+enum class aliased { first, second, also_second = second, third };
+
+enum class wide : std::int16_t { low = -1000, zero = 0, high = 1000 };
+
+template <>
+struct uninttp::enum_range<wide> final {
+    static constexpr std::intmax_t min = -1000;
+    static constexpr std::intmax_t max = 1000;
+};
+
+enum class nothing {};
+
+// Names at compile time
+static_assert(enum_name_v<order_state::filled> == "filled");
+static_assert(enum_name_v<venue::xnas> == "xnas");
+static_assert(enum_name_v<venue::bats_2> == "bats_2");
+static_assert(enum_name_v<venue::_hidden> == "_hidden");
+static_assert(enum_name_v<static_cast<order_state>(2)>.empty());
+static_assert(enum_name_v<aliased::also_second> == "second");
+static_assert(enum_name_v<enum_cast<order_state>("filled").value()> == "filled");
+
+// Listing the enumerators
+static_assert(enum_values<order_state> == std::array { order_state::pending, order_state::filled, order_state::cancelled });
+static_assert(enum_names<order_state> == std::array<std::string_view, 3> { "pending", "filled", "cancelled" });
+static_assert(enum_values<venue::code> == std::array { venue::_hidden, venue::xnas, venue::arcx, venue::bats_2, venue::edgx });
+static_assert(enum_names<aliased> == std::array<std::string_view, 3> { "first", "second", "third" });
+static_assert(enum_values<nothing>.empty() && enum_names<nothing>.empty());
+
+// The range is clamped to the underlying type, and can be widened
+static_assert(enum_names<side> == std::array<std::string_view, 2> { "buy", "sell" });
+static_assert(enum_names<wide> == std::array<std::string_view, 3> { "low", "zero", "high" });
+
+// Lookups by value
+static_assert(enum_name(order_state::cancelled) == "cancelled");
+static_assert(enum_name(order_state::pending) == "pending");
+static_assert(enum_name(static_cast<order_state>(0)).empty());
+static_assert(enum_name(static_cast<order_state>(5)).empty());
+static_assert(enum_name(static_cast<order_state>(10)).empty());
+static_assert(enum_name(static_cast<order_state>(-1)).empty());
+static_assert(enum_name(static_cast<order_state>(1 << 30)).empty());
+static_assert(enum_name(venue::_hidden) == "_hidden" && enum_name(venue::edgx) == "edgx" && enum_name(venue::arcx) == "arcx");
+static_assert(enum_name(side::both).empty());
+static_assert(enum_name(aliased::also_second) == "second");
+static_assert(enum_name(wide::low) == "low" && enum_name(wide::high) == "high");
+static_assert(enum_name(nothing{}).empty());
+
+// Lookups by name
+static_assert(enum_cast<order_state>("pending") == order_state::pending);
+static_assert(enum_cast<order_state>("cancelled") == order_state::cancelled);
+static_assert(!enum_cast<order_state>("shipped"));
+static_assert(!enum_cast<order_state>(""));
+static_assert(!enum_cast<order_state>("Pending"));
+static_assert(!enum_cast<order_state>("pendin"));
+static_assert(!enum_cast<order_state>("pendingg"));
+static_assert(!enum_cast<aliased>("also_second"));
+static_assert(enum_cast<venue::code>("bats_2") == venue::bats_2);
+static_assert(enum_cast<wide>("high") == wide::high);
+static_assert(!enum_cast<nothing>("anything"));
+
+// Every name maps back to its value
+template <typename E>
+constexpr bool round_trips() {
+    for (std::size_t i = 0; i < enum_values<E>.size(); i++)
+        if (enum_cast<E>(enum_names<E>[i]) != enum_values<E>[i] || enum_name(enum_values<E>[i]) != enum_names<E>[i])
+            return false;
+    return true;
+}
+
+static_assert(round_trips<order_state>() && round_trips<venue::code>() && round_trips<side>() && round_trips<aliased>() && round_trips<wide>());
+
+int main() {
+    // The names are null-terminated
+    assert(std::strcmp(enum_name_v<order_state::filled>.data(), "filled") == 0);
+    assert(std::strcmp(enum_name(venue::bats_2).data(), "bats_2") == 0);
+    for (const auto name : enum_names<wide>)
+        assert(name.data()[name.size()] == '\0');
+
+    // The same at run time
+    volatile int n = 9;
+    assert(enum_name(static_cast<order_state>(n)) == "cancelled");
+    n = 3;
+    assert(enum_name(static_cast<order_state>(n)).empty());
+    const std::string name = "filled";
+    assert(enum_cast<order_state>(name) == order_state::filled);
+}
@@ -0,0 +1,26 @@
+#include <uninttp/escape.hpp>
+#include <cassert>
+#include <cstring>
+
+using namespace uninttp;
+
+static_assert(uni_auto_sv<json_escaped_v<"say \"hi\"\\ \b\f\n\r\t">> == R"(say \"hi\"\\ \b\f\n\r\t)");
+static_assert(uni_auto_sv<json_escaped_v<"\x01\x1F\x7F">> == "\\u0001\\u001F\x7F");
+static_assert(uni_auto_sv<json_escaped_v<"h\xC3\xA9">> == "h\xC3\xA9"); // UTF-8 passes through
+static_assert(uni_auto_sv<json_escaped_v<"">>.empty());
+
+static_assert(uni_auto_sv<url_encoded_v<"AZaz09-_.~">> == "AZaz09-_.~");
+static_assert(uni_auto_sv<url_encoded_v<"a b/c?d=e&f">> == "a%20b%2Fc%3Fd%3De%26f");
+static_assert(uni_auto_sv<url_encoded_v<"\xC3\xA9">> == "%C3%A9");
+
+static_assert(uni_auto_sv<csv_quoted_v<"a,b">> == R"("a,b")");
+static_assert(uni_auto_sv<csv_quoted_v<"say \"hi\"">> == R"("say ""hi""")");
+static_assert(uni_auto_sv<csv_quoted_v<"">> == R"("")");
+
+static_assert(uni_auto_sv<html_escaped_v<"<a href=\"x\">Tom & Jerry's</a>">> == "&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&#39;s&lt;/a&gt;");
+
+int main() {
+    // The results are null-terminated constants of a known length
+    constexpr auto fragment = json_escaped_v<"line\n">;
+    assert(std::strlen(fragment.data()) == uni_auto_sv<fragment>.size() && uni_auto_sv<fragment>.size() == 6);
+}
@@ -0,0 +1,129 @@
+#include <uninttp/flags.hpp>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+using namespace uninttp;
+
+enum class level : std::int8_t { quiet = -1, normal, loud };
+
+struct options {
+    int threads = 1;
+    bool verbose = false;
+    std::string_view output;
+    double ratio = 0;
+    std::uint16_t port = 0;
+    level lvl = level::normal;
+    char tag[5] = "none";
+    bool dry_run = false;
+};
+
+using cli = flags<flag<"threads", &options::threads, "Number of worker threads">,
+                  flag<"verbose", &options::verbose, "Log every record">,
+                  flag<"output", &options::output, "Where to write the results">,
+                  flag<"ratio", &options::ratio>,
+                  flag<"port", &options::port, "Port to listen on">,
+                  flag<"level", &options::lvl, "How much to log">,
+                  flag<"tag", &options::tag, "At most 4 characters">,
+                  flag<"dry-run", &options::dry_run, "Don't write anything">>;
+
+static_assert(cli::help ==
+    "  --threads=<int>    Number of worker threads\n"
+    "  --verbose          Log every record\n"
+    "  --output=<string>  Where to write the results\n"
+    "  --ratio=<number>\n"
+    "  --port=<uint>      Port to listen on\n"
+    "  --level=<int>      How much to log\n"
+    "  --tag=<string>     At most 4 characters\n"
+    "  --dry-run          Don't write anything\n");
+
+using one = flags<flag<"x", &options::threads>>;
+
+static_assert(one::help == "  --x=<int>\n");
+
+static flags_result parse(const std::initializer_list<const char*> args, options& opts) {
+    return cli::parse(static_cast<int>(args.size()), args.begin(), opts);
+}
+
+int main() {
+    // Both ways of passing values, and switches
+    {
+        options opts;
+        const auto [index, ec] = parse({ "prog", "--threads=8", "--output", "out.csv", "--verbose", "--ratio=0.25", "--port", "8080",
+                                         "--level=-1", "--tag=abcd", "--dry-run=false", "input.csv" }, opts);
+        assert(ec == std::errc{} && index == 11);
+        assert(opts.threads == 8 && opts.verbose && opts.output == "out.csv" && opts.ratio == 0.25 && opts.port == 8080);
+        assert(opts.lvl == level::quiet && std::strcmp(opts.tag, "abcd") == 0 && !opts.dry_run);
+    }
+
+    // Absent flags are left untouched, and the last of repeated flags wins
+    {
+        options opts;
+        assert(parse({ "prog", "--threads=2", "--threads", "3", "--verbose=true", "--verbose=0" }, opts).ec == std::errc{});
+        assert(opts.threads == 3 && !opts.verbose && opts.output.empty() && opts.port == 0 && std::strcmp(opts.tag, "none") == 0);
+    }
+
+    // Where the flags stop
+    {
+        options opts;
+        auto r = parse({ "prog" }, opts);
+        assert(r.ec == std::errc{} && r.index == 1);
+        r = parse({ "prog", "input.csv", "--threads=4" }, opts);
+        assert(r.ec == std::errc{} && r.index == 1 && opts.threads == 1);
+        r = parse({ "prog", "--threads=4", "--", "--verbose" }, opts);
+        assert(r.ec == std::errc{} && r.index == 3 && opts.threads == 4 && !opts.verbose);
+        r = parse({ "prog", "-v" }, opts);
+        assert(r.ec == std::errc{} && r.index == 1);
+        r = parse({ "prog", "--output=" }, opts);
+        assert(r.ec == std::errc{} && opts.output.empty() && opts.output.data() != nullptr);
+        r = parse({ "prog", "--output", "--verbose" }, opts); // A value can look like a flag
+        assert(r.ec == std::errc{} && r.index == 3 && opts.output == "--verbose" && !opts.verbose);
+    }
+
+    // Errors, with the index of the argument at fault
+    {
+        options opts;
+        const auto fails = [&](const std::initializer_list<const char*> args, const int index, const std::errc ec) {
+            const auto r = parse(args, opts);
+            return r.index == index && r.ec == ec;
+        };
+        assert(fails({ "prog", "--threads=1", "--thread=2" }, 2, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threadss" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--=1" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--dry_run" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threads" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threads=" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threads=12x" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threads", "x" }, 2, std::errc::invalid_argument));
+        assert(fails({ "prog", "--threads=99999999999" }, 1, std::errc::result_out_of_range));
+        assert(fails({ "prog", "--port=65536" }, 1, std::errc::result_out_of_range));
+        assert(fails({ "prog", "--port=-1" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--level=128" }, 1, std::errc::result_out_of_range));
+        assert(fails({ "prog", "--verbose=yes" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--ratio=abc" }, 1, std::errc::invalid_argument));
+        assert(fails({ "prog", "--tag=abcde" }, 1, std::errc::value_too_large));
+        assert(std::strcmp(opts.tag, "none") == 0);
+    }
+
+    // Environment variables
+    {
+        options opts;
+        setenv("TEST_THREADS", "6", 1);
+        setenv("TEST_DRY_RUN", "true", 1);
+        setenv("TEST_TAG", "xy", 1);
+        setenv("THREADS", "7", 1);
+        assert(cli::parse_env<"TEST_">(opts) == std::errc{});
+        assert(opts.threads == 6 && opts.dry_run && std::strcmp(opts.tag, "xy") == 0 && opts.output.empty());
+        assert(cli::parse_env(opts) == std::errc{} && opts.threads == 7);
+        setenv("TEST_PORT", "http", 1);
+        assert(cli::parse_env<"TEST_">(opts) == std::errc::invalid_argument);
+        setenv("TEST_PORT", "70000", 1);
+        assert(cli::parse_env<"TEST_">(opts) == std::errc::result_out_of_range);
+        unsetenv("TEST_PORT");
+        unsetenv("TEST_TAG");
+        unsetenv("TEST_DRY_RUN");
+        unsetenv("TEST_THREADS");
+        unsetenv("THREADS");
+    }
+}
@@ -0,0 +1,74 @@
+#include <uninttp/format.hpp>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <string>
+
+using namespace uninttp;
+
+static_assert(uni_auto_sv<format_v<"{}-{:08x}", "orders", 48879>> == "orders-0000beef");
+static_assert(uni_auto_sv<format_v<"{1}{0}{1}", 'a', 'b'>> == "bab");
+static_assert(uni_auto_sv<format_v<"{{{}}}", true>> == "{true}");
+static_assert(uni_auto_sv<format_v<"[{:>6}|{:<4}|{:^5}]", -42, "ab", 'c'>> == "[   -42|ab  |  c  ]");
+static_assert(uni_auto_sv<format_v<"no fields">> == "no fields");
+
+// format_v combines constants of every kind, and its result can itself be formatted
+constexpr auto version = format_v<"{}.{}{:+.1f}", 2, 'x', 0.25>;
+static_assert(uni_auto_sv<version> == "2.x+0.2");
+static_assert(uni_auto_sv<format_v<"[{:>9}] {:#x}", version, 255u>> == "[  2.x+0.2] 0xff");
+static_assert(uni_auto_sv<format_v<"{}{}", "", 1e100>> == "1e+100");
+static_assert(uni_auto_sv<version>.data()[uni_auto_sv<version>.size()] == '\0');
+
+int main() {
+    // The example from the README
+    {
+        char buf[64];
+        const auto end = uninttp::format<"x={} y={:.3f}">(buf, 42, 3.14159);
+        assert(std::string_view(buf, end) == "x=42 y=3.142");
+    }
+
+    // Specs of every shape, explicit indices (which may repeat), and literal braces next to fields
+    {
+        std::string out;
+        uninttp::format<"{{{1:*^7}}} {0:+#x} {1} {2:.2e} {3}">(std::back_inserter(out), 255, "mid", 1234.5, std::string_view("sv"));
+        assert(out == "{**mid**} +0xff mid 1.23e+03 sv");
+    }
+
+    // The same spec text stays tied to its own argument's type
+    {
+        std::string out;
+        uninttp::format<"{:>4}|{:>4}">(std::back_inserter(out), 7, "z");
+        assert(out == "   7|   z");
+    }
+
+    // Capped output still reports the full size
+    {
+        char buf[8];
+        const auto [end, size] = uninttp::format_to_n<"{}:{:05}">(buf, 6, "abc", 42);
+        assert(std::string_view(buf, end) == "abc:00" && size == 9);
+        const auto [none, full] = uninttp::format_to_n<"{}">(buf, 0, 123456789);
+        assert(none == buf && full == 9);
+    }
+
+    // Capping at every point, whether within the constant text or within a field
+    {
+        constexpr std::string_view whole = "[{7}] ok=true }";
+        for (std::ptrdiff_t n = -1; n <= static_cast<std::ptrdiff_t>(whole.size()) + 2; n++) {
+            std::string out;
+            const auto [end, size] = uninttp::format_to_n<"[{{{}}}] ok={} }}">(std::back_inserter(out), n, 7, true);
+            assert(out == whole.substr(0, static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(n, 0, whole.size()))));
+            assert(size == static_cast<std::ptrdiff_t>(whole.size()));
+        }
+    }
+
+    // Constant text alone, and nothing at all
+    {
+        std::string out;
+        uninttp::format<"a{{b}}c">(std::back_inserter(out));
+        uninttp::format<"">(std::back_inserter(out), 1);
+        assert(out == "a{b}c");
+        char buf[4];
+        const auto [end, size] = uninttp::format_to_n<"a{{b}}c">(buf, 3);
+        assert(std::string_view(buf, end) == "a{b" && size == 5);
+    }
+}
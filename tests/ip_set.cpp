@@ -0,0 +1,111 @@
+#include <uninttp/ip_set.hpp>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace uninttp;
+
+using private_networks = ip_set<"10.0.0.0/8", "172.16.0.0/12", "192.168.0.0/16", "fc00::/7">;
+
+// Overlapping and adjacent prefixes merge, and host bits are cleared
+using merged = ip_set<"10.0.0.0/9", "10.128.0.0/9", "10.1.2.3/16", "11.0.0.0/8", "13.0.0.0/8", "2001:db8::/33", "2001:db8:8000::/33", "2001:db9::1/128">;
+static_assert(merged::v4_range_count == 2 && merged::v6_range_count == 2);
+static_assert(merged::contains("11.255.255.255") && !merged::contains("12.0.0.0") && merged::contains("13.0.0.0"));
+static_assert(merged::contains("2001:db8:ffff:ffff:ffff:ffff:ffff:ffff") && !merged::contains("2001:db9::") && merged::contains("2001:db9::1"));
+
+// The whole address space, and a single address at either end of it
+using everything = ip_set<"0.0.0.0/0", "::/0">;
+using ends = ip_set<"0.0.0.0/32", "255.255.255.255", "::/128", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128">;
+static_assert(everything::v4_range_count == 1 && everything::contains(0u) && everything::contains(0xFFFFFFFFu) && everything::contains("::"));
+static_assert(ends::v4_range_count == 2 && ends::contains(0u) && ends::contains(0xFFFFFFFFu) && !ends::contains(1u) && !ends::contains(0xFFFFFFFEu));
+static_assert(ends::contains("::") && ends::contains("FFFF:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF") && !ends::contains("::1"));
+
+// Only one address family
+using v4_only = ip_set<"127.0.0.0/8">;
+static_assert(v4_only::v6_range_count == 0 && !v4_only::contains("::1") && v4_only::contains("127.1.2.3"));
+
+// Textual addresses: IPv6 compression, embedded IPv4, and malformed input
+static_assert(private_networks::contains("192.168.1.20") && !private_networks::contains("192.169.0.0") && !private_networks::contains("172.32.0.0"));
+static_assert(private_networks::contains("fd12:3456::1") && private_networks::contains("fc00::") && !private_networks::contains("fe80::1"));
+static_assert(private_networks::contains("fdff:ffff:ffff:ffff:ffff:ffff:255.255.255.255") && private_networks::contains("fd00:0:0:0:0:0:0:1"));
+static_assert(!private_networks::contains("10.0.0") && !private_networks::contains("10.0.0.256") && !private_networks::contains("10.0.0.0.0"));
+static_assert(!private_networks::contains("10..0.0") && !private_networks::contains("10.0.0.0/8") && !private_networks::contains(""));
+static_assert(!private_networks::contains("fd00::1::2") && !private_networks::contains("fd00:") && !private_networks::contains("fd00:0:0:0:0:0:0:0:1"));
+static_assert(!private_networks::contains("fd00::12345") && !private_networks::contains("fd00::g") && !private_networks::contains(":fd00::1"));
+
+// A set that takes several halving steps, with prefixes of many lengths
+using scattered = ip_set<"1.0.0.0/8", "3.3.0.0/16", "5.5.5.0/24", "7.7.7.7", "9.0.0.0/7", "64.0.0.0/3", "128.0.0.0/2", "200.1.0.0/17",
+                         "200.1.192.0/18", "223.255.255.0/25", "240.0.0.0/5", "2000::/3", "2001:db8::/32", "3fff::/16", "fe80::/10", "ff00::/8">;
+static_assert(scattered::v4_range_count == 11 && scattered::v6_range_count == 3);
+
+struct prefix_v4 {
+    std::uint32_t address;
+    unsigned length;
+};
+
+// The same prefixes as `scattered`, looked up the slow way
+constexpr prefix_v4 scattered_v4[] { { 0x01000000, 8 }, { 0x03030000, 16 }, { 0x05050500, 24 }, { 0x07070707, 32 }, { 0x09000000, 7 }, { 0x40000000, 3 },
+                                     { 0x80000000, 2 }, { 0xC8010000, 17 }, { 0xC801C000, 18 }, { 0xDFFFFF00, 25 }, { 0xF0000000, 5 } };
+
+static bool reference_contains(const std::uint32_t a) {
+    for (const auto [address, length] : scattered_v4)
+        if (length == 0 || (a ^ address) >> (32 - length) == 0)
+            return true;
+    return false;
+}
+
+int main() {
+    // Addresses at, next to, and between the ends of every prefix, plus pseudorandom ones, one at a time and in batches of every size
+    std::vector<std::uint32_t> addresses;
+    for (const auto [address, length] : scattered_v4) {
+        const auto last = address | (length == 32 ? 0 : ~std::uint32_t(0) >> length);
+        for (const auto a : { address - 1, address, address + 1, last - 1, last, last + 1 })
+            addresses.push_back(a);
+    }
+    for (std::uint32_t x = 0x12345678, i = 0; i < 10000; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        addresses.push_back(x);
+    }
+    std::size_t expected_hits = 0;
+    for (const auto a : addresses) {
+        assert(scattered::contains(a) == reference_contains(a));
+        expected_hits += reference_contains(a);
+    }
+    for (std::size_t n = 0; n <= 20; n++) {
+        bool out[20];
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < n; i++)
+            hits += reference_contains(addresses[i]);
+        assert(scattered::contains(addresses.data(), addresses.data() + n, out) == hits);
+        for (std::size_t i = 0; i < n; i++)
+            assert(out[i] == reference_contains(addresses[i]));
+    }
+    {
+        const auto out = std::make_unique<bool[]>(addresses.size());
+        assert(scattered::contains(addresses.data(), addresses.data() + addresses.size(), out.get()) == expected_hits);
+    }
+
+    // IPv6 addresses in network byte order, one at a time and in a batch that isn't a multiple of the lanes
+    {
+        using bytes = std::array<std::uint8_t, 16>;
+        const bytes v6[] {
+            { 0x20, 0x01, 0x0d, 0xb8 },                   // 2001:db8::, within 2000::/3
+            { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, // The last of 2000::/3
+            { 0x40 },                                     // 4000::
+            { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+            { 0xfe, 0xc0 },                               // Just past fe80::/10
+            { 0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+            {},                                           // ::
+            { 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, // Just before 2000::/3
+            { 0x20 },
+        };
+        constexpr bool expected[] { true, true, false, true, false, true, false, false, true };
+        bool out[std::size(v6)];
+        assert(scattered::contains(std::begin(v6), std::end(v6), out) == 5);
+        for (std::size_t i = 0; i < std::size(v6); i++)
+            assert(out[i] == expected[i] && scattered::contains(v6[i]) == expected[i]);
+    }
+}
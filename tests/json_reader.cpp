@@ -0,0 +1,120 @@
+#include <uninttp/json_reader.hpp>
+#include <cassert>
+#include <cstring>
+#include <string>
+
+using namespace uninttp;
+
+enum class side : unsigned char { buy = 1, sell = 2 };
+
+struct order {
+    long id;
+    double price;
+    std::string_view symbol;
+    bool live;
+    side s;
+    char note[8];
+    int fills[3];
+};
+
+using order_reader = json_reader<field<"id", &order::id>,
+                                 field<"px", &order::price>,
+                                 field<"sym", &order::symbol>,
+                                 field<"live", &order::live>,
+                                 field<"side", &order::s>,
+                                 field<"note", &order::note>,
+                                 field<"fills", &order::fills>>;
+
+// Many keys sharing their length and most of their bytes, so that the hash has to find the bytes that tell them apart
+struct wide {
+    int k_alpha_0, k_alpha_1, k_alpha_2, k_alpha_3, k_alpha_4, k_alpha_5, k_alpha_6, k_alpha_7, k_alpha_8, k_alpha_9;
+};
+
+using wide_reader = json_reader<field<"k_alpha_0", &wide::k_alpha_0>, field<"k_alpha_1", &wide::k_alpha_1>,
+                                field<"k_alpha_2", &wide::k_alpha_2>, field<"k_alpha_3", &wide::k_alpha_3>,
+                                field<"k_alpha_4", &wide::k_alpha_4>, field<"k_alpha_5", &wide::k_alpha_5>,
+                                field<"k_alpha_6", &wide::k_alpha_6>, field<"k_alpha_7", &wide::k_alpha_7>,
+                                field<"k_alpha_8", &wide::k_alpha_8>, field<"k_alpha_9", &wide::k_alpha_9>>;
+
+static std::errc read_ec(const std::string_view json) {
+    order o{};
+    return order_reader::read(json, o).ec;
+}
+
+int main() {
+    // Fields in their declared order, unknown keys of every kind skipped, and whatever follows the object left alone
+    {
+        const std::string_view json = R"({ "id" : 42, "venue": "X\"}", "px": 101.25, "extra": {"a": [1, {"b": "]"}], "c": null},
+                                          "sym": "A\"B", "live": true, "side": 2, "note": "hé\n", "fills": [1, -2] } tail)";
+        order o{};
+        o.fills[2] = 9;
+        const auto [end, ec] = order_reader::read(json, o);
+        assert(ec == std::errc{} && std::string_view(end) == " tail");
+        assert(o.id == 42 && o.price == 101.25 && o.live && o.s == side::sell);
+        assert(o.symbol == R"(A\"B)"); // Views keep escape sequences
+        assert(std::strcmp(o.note, "h\xC3\xA9\n") == 0);
+        assert(o.fills[0] == 1 && o.fills[1] == -2 && o.fills[2] == 9); // Elements past the end of the JSON array are untouched
+    }
+
+    // Skipping nested values, with brackets and quotes at every offset within the eight-byte words scanned
+    for (std::size_t pad = 0; pad < 16; pad++) {
+        const std::string gap(pad, ' ');
+        const auto json = R"({"extra":[)" + gap + R"({"a":"}]{[\""},)" + gap + R"([[],{}],"x[y]z{w}"]  , "more": {"b":[1,)" + gap + "2]}" + gap
+                        + R"(, "id": 5})";
+        order o{};
+        assert(order_reader::read(json, o).ec == std::errc{} && o.id == 5);
+        assert(read_ec(json.substr(0, json.find(R"(, "id")") - 1)) == std::errc::invalid_argument);
+    }
+
+    // Out of order, repeated and absent keys
+    {
+        order o{};
+        o.id = 7;
+        assert(order_reader::read(R"({"live":false,"px":1e3,"px":-0.5,"sym":""})", o).ec == std::errc{});
+        assert(o.id == 7 && o.price == -0.5 && o.symbol.empty() && !o.live);
+        assert(order_reader::read("{}", o).ec == std::errc{} && o.id == 7);
+    }
+
+    // Every key, in any order, lands on its own member
+    {
+        wide w{};
+        assert(wide_reader::read(R"({"k_alpha_9":9,"k_alpha_3":3,"k_alpha_0":0,"k_alpha_7":7,"k_alpha_1":1,"k_alpha_8":8,)"
+                                 R"("k_alpha_2":2,"k_alpha_6":6,"k_alpha_4":4,"k_alpha_5":5,"k_alpha_":-1,"k_alpha_10":-1})", w).ec == std::errc{});
+        const int got[] { w.k_alpha_0, w.k_alpha_1, w.k_alpha_2, w.k_alpha_3, w.k_alpha_4, w.k_alpha_5, w.k_alpha_6, w.k_alpha_7, w.k_alpha_8, w.k_alpha_9 };
+        for (int i = 0; i < 10; i++)
+            assert(got[i] == i);
+    }
+
+    // \u escapes, with surrogate pairs decoded into one code point
+    {
+        order o{};
+        assert(order_reader::read(R"({"note":"\u0041\u00e9\ud83d\ude00"})", o).ec == std::errc{});
+        assert(std::strcmp(o.note, "A\xC3\xA9\xF0\x9F\x98\x80") == 0);
+        assert(order_reader::read(R"({"note":"\uD834\uDD1E\u20ac"})", o).ec == std::errc{});
+        assert(std::strcmp(o.note, "\xF0\x9D\x84\x9E\xE2\x82\xAC") == 0);
+        for (const auto json : { R"({"note":"\ud83d"})", R"({"note":"\ud83dx"})", R"({"note":"\ud83d\u0041"})", R"({"note":"\ud83d\ud83d"})",
+                                 R"({"note":"\ude00"})", R"({"note":"\ude00\ud83d"})", R"({"note":"\ud83d\ude0"})" })
+            assert(read_ec(json) == std::errc::invalid_argument);
+    }
+
+    // Malformed input
+    for (const auto json : { "", "[]", R"({"id":})", R"({"id":4.5})", R"({"id":"4"})", R"({"id":1,})", R"({"id":1)", R"({"live":tru})",
+                             R"({"sym":"abc)", R"({"note":"\q"})", R"({"note":"\u00"})", R"({"x":{"y":1})", R"({"id" 1})" })
+        assert(read_ec(json) == std::errc::invalid_argument);
+
+    // Values that don't fit their members
+    assert(read_ec(R"({"id":99999999999999999999})") == std::errc::result_out_of_range);
+    assert(read_ec(R"({"side":256})") == std::errc::result_out_of_range);
+    assert(read_ec(R"({"note":"1234567"})") == std::errc{});
+    assert(read_ec(R"({"note":"12345678"})") == std::errc::value_too_large);
+    assert(read_ec(R"({"note":"123456é"})") == std::errc::value_too_large);
+    assert(read_ec(R"({"fills":[1,2,3,4]})") == std::errc::value_too_large);
+
+    // Reading stops where the error is
+    {
+        order o{};
+        const std::string json = R"({"id":1,"px":x})";
+        const auto [end, ec] = order_reader::read(json, o);
+        assert(ec == std::errc::invalid_argument && end == json.data() + json.rfind('x'));
+    }
+}
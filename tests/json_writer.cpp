@@ -0,0 +1,80 @@
+#include <uninttp/json_writer.hpp>
+#include <cassert>
+#include <limits>
+#include <string>
+
+using namespace uninttp;
+
+struct order {
+    long id;
+    double price;
+    bool live;
+};
+
+using order_writer = json_writer<field<"id", &order::id>,
+                                 field<"px", &order::price>,
+                                 field<"live", &order::live>>;
+
+enum class side : unsigned char { buy = 1, sell = 2 };
+
+struct tagged {
+    side s;
+    std::string_view note;
+    int qty;
+};
+
+using tagged_writer = json_writer<field<"side", &tagged::s>,
+                                  field<"note \"q\"", &tagged::note>,
+                                  field<"qty", &tagged::qty>>;
+
+static_assert(order_writer::max_size >= sizeof R"({"id":-9223372036854775808,"px":-2.2250738585072014e-308,"live":false})" - 1);
+static_assert(tagged_writer::max_size == 0); // Strings aren't bounded
+
+template <typename Writer, typename T>
+static std::string write_all(const T& obj) {
+    char buf[256];
+    const auto [end, ec] = Writer::write(buf, buf + sizeof buf, obj);
+    assert(ec == std::errc{});
+    return { buf, end };
+}
+
+// Checks that `expected` needs a buffer of exactly its own size
+template <typename Writer, typename T>
+static void check_exact_fit(const T& obj, const std::string_view expected) {
+    char buf[64];
+    for (std::size_t n = 0; n < expected.size(); n++) {
+        const auto [end, ec] = Writer::write(buf, buf + n, obj);
+        assert(ec == std::errc::value_too_large && end == buf + n);
+    }
+    const auto [end, ec] = Writer::write(buf, buf + expected.size(), obj);
+    assert(ec == std::errc{} && std::string_view(buf, end) == expected);
+}
+
+int main() {
+    // Fast path: the buffer is at least max_size
+    {
+        char buf[order_writer::max_size];
+        const auto [end, ec] = order_writer::write(buf, buf + sizeof buf, order{ 42, 101.25, true });
+        assert(ec == std::errc{} && std::string_view(buf, end) == R"({"id":42,"px":101.25,"live":true})");
+    }
+
+    // The widest values of each type still fit in max_size
+    {
+        constexpr order widest{ std::numeric_limits<long>::min(), -std::numeric_limits<double>::denorm_min(), false };
+        char buf[order_writer::max_size];
+        const auto [end, ec] = order_writer::write(buf, buf + sizeof buf, widest);
+        assert(ec == std::errc{} && static_cast<std::size_t>(end - buf) <= order_writer::max_size);
+    }
+
+    // Non-finite numbers become null
+    assert(write_all<order_writer>(order{ -1, std::numeric_limits<double>::infinity(), false }) == R"({"id":-1,"px":null,"live":false})");
+    assert(write_all<order_writer>(order{ 0, std::numeric_limits<double>::quiet_NaN(), true }) == R"({"id":0,"px":null,"live":true})");
+
+    // Enumerations are written as integers, and both keys and strings are escaped
+    assert(write_all<tagged_writer>(tagged{ side::sell, "a \"b\"\n", 7 }) == R"({"side":2,"note \"q\"":"a \"b\"\n","qty":7})");
+    assert(write_all<tagged_writer>(tagged{ side::buy, "", -3 }) == R"({"side":1,"note \"q\"":"","qty":-3})");
+
+    // Every buffer short of the exact size is rejected, on both the checked and unchecked paths
+    check_exact_fit<order_writer>(order{ 42, 101.25, true }, R"({"id":42,"px":101.25,"live":true})");
+    check_exact_fit<tagged_writer>(tagged{ side::buy, "\"\"\"", 5 }, R"({"side":1,"note \"q\"":"\"\"\"","qty":5})");
+}
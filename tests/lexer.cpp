@@ -0,0 +1,50 @@
+#include <uninttp/lexer.hpp>
+#include <cassert>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace uninttp;
+
+using scanner = lexer<"if", "[A-Za-z_]\\w*", "[0-9]+", regex_escaped_v<"+=">, regex_escaped_v<"+">, "\\s+">;
+
+enum kind : std::size_t { keyword, identifier, number, plus_assign, plus, space };
+
+using tokens = std::vector<std::pair<std::size_t, std::string_view>>;
+
+/* The kinds and spellings of all the tokens of `text` */
+constexpr auto scan(const std::string_view text, const std::size_t offset = 0) {
+    tokens out;
+    scanner s { text, offset };
+    s.for_each([&](const scanner::token& t) { out.emplace_back(t.kind, t.text); });
+    return out;
+}
+
+// Maximal munch, with ties going to the rule listed first
+static_assert(scan("if x += 42") == tokens { { keyword, "if" }, { space, " " }, { identifier, "x" }, { space, " " }, { plus_assign, "+=" }, { space, " " }, { number, "42" } });
+static_assert(scan("iffy") == tokens { { identifier, "iffy" } });
+static_assert(scan("a+b") == tokens { { identifier, "a" }, { plus, "+" }, { identifier, "b" } });
+static_assert(scan("").empty());
+
+// A byte that starts no token is a one-byte error token, and scanning carries on after it
+static_assert(scan("x?1") == tokens { { identifier, "x" }, { scanner::error, "?" }, { number, "1" } });
+
+// Resuming from a saved offset gives the same tokens as the original scan did from there
+static_assert(scan("if x += 42", 5) == tokens { { plus_assign, "+=" }, { space, " " }, { number, "42" } });
+
+int main() {
+    const std::string source = "count += 10";
+    scanner s { source };
+    const auto first = s.next();
+    assert(first && first->kind == identifier && first->offset == 0 && first->text == "count");
+    const auto resume = s.offset();
+    assert(resume == 5);
+
+    std::size_t seen = 0;
+    s.for_each([&](const scanner::token& t) { return t.kind != plus_assign && ++seen; });
+    assert(seen == 1 && s.offset() == 8);
+
+    scanner again { source, resume };
+    assert(again.next()->kind == space && again.next()->text == "+=" && again.next()->kind == space && again.next()->kind == number);
+    assert(!again.next());
+}
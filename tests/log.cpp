@@ -0,0 +1,69 @@
+#include <uninttp/log.hpp>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Every test runs its producers on threads of their own, since a thread's ring buffer is sized on its first call to log()
+template <typename F>
+static void on_new_thread(F f) {
+    std::thread { f }.join();
+}
+
+static std::vector<std::string> drain_all() {
+    std::vector<std::string> lines;
+    uninttp::log_drain([&](const std::string_view line) { lines.emplace_back(line); });
+    return lines;
+}
+
+int main() {
+    // Deferred formatting of every kind of argument, with strings copied so that they may die before the consumer gets to them
+    on_new_thread([] {
+        {
+            std::string s = "temporary";
+            assert(uninttp::log<"order {} filled at {:.2f} on {} ({})">(42, 101.256, s, 'x'));
+            s.assign(s.size(), '#');
+        }
+        assert(uninttp::log<"{}|{:>3}|{}">(true, 7u, "")); // Events from the same thread come in order
+        assert(uninttp::log<"no arguments">());
+    });
+    assert((drain_all() == std::vector<std::string> { "order 42 filled at 101.26 on temporary (x)", "true|  7|", "no arguments" }));
+    assert(drain_all().empty());
+
+    // Records of every size around the wrap point of a tiny ring, with a consumer emptying it concurrently
+    uninttp::set_log_buffer_size(64);
+    std::vector<std::string> lines;
+    std::atomic<bool> done = false;
+    std::thread consumer { [&] {
+        const auto sink = [&](const std::string_view line) { lines.emplace_back(line); };
+        while (!done.load(std::memory_order_acquire))
+            uninttp::log_drain(sink);
+        uninttp::log_drain(sink);
+    } };
+    std::vector<std::string> expected;
+    on_new_thread([&] {
+        // An index (4 bytes) and a string (4 bytes plus its characters) after the 16-byte header fit a 64-byte ring for up to 40 characters
+        for (int i = 0; i < 2000; i++) {
+            const std::string s(static_cast<std::size_t>(i * 7 % 41), static_cast<char>('a' + i % 26));
+            assert(uninttp::log<"{} {}">(i, s));
+            expected.push_back(std::to_string(i) + ' ' + s);
+        }
+        assert(!uninttp::log<"{} {}">(0, std::string(41, 'z'))); // Too big for even an empty ring
+    });
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    assert(lines == expected);
+
+    // The case that used to wait forever: a small record, then a full-ring one that has to wrap around
+    on_new_thread([] {
+        assert(uninttp::log<"{}">(std::string(8, 'a')));
+        assert(drain_all().size() == 1);
+        std::thread drainer { [] {
+            while (drain_all().empty())
+                std::this_thread::yield();
+        } };
+        assert(uninttp::log<"{}">(std::string(40, 'b')));
+        drainer.join();
+    });
+    assert(drain_all().empty());
+}
@@ -0,0 +1,62 @@
+#include <uninttp/message_template.hpp>
+#include <uninttp/base_encoding.hpp>
+#include <cassert>
+#include <string_view>
+#include <vector>
+
+using namespace uninttp;
+
+using order_header = message_template<"8=FIX.4.4\x01" "34=00000000\x01" "55=        \x01",
+                                      patch<13, 8, patch_encoding::decimal>,
+                                      patch<25, 8, patch_encoding::text>>;
+
+enum class msg_type : std::uint8_t { add = 'A' };
+
+// A binary header from hex_v: magic, a 16-bit big-endian length, a type, a 24-bit little-endian sequence number and a signed 8-byte price
+using binary_header = message_template<hex_v<"CAFE" "0000" "00" "000000" "0000000000000000">,
+                                       patch<2, 2>,
+                                       patch<4, 1>,
+                                       patch<5, 3, patch_encoding::little_endian>,
+                                       patch<8, 8, patch_encoding::little_endian>>;
+
+static_assert(order_header::size == 34 && std::is_same_v<order_header::value_type, char>);
+static_assert(binary_header::size == 16 && std::is_same_v<binary_header::value_type, std::byte>);
+
+template <typename... Bytes>
+static std::vector<std::byte> bytes(const Bytes... b) {
+    return { static_cast<std::byte>(b)... };
+}
+
+int main() {
+    // Text slots
+    {
+        char buf[order_header::size];
+        assert(order_header::build(buf, 1234, "AAPL"));
+        assert(std::string_view(buf, sizeof buf) == "8=FIX.4.4\x01" "34=00001234\x01" "55=AAPL    \x01");
+        assert(order_header::fill(buf, 99999999u, std::string_view("ABCDEFGH")));
+        assert(std::string_view(buf, sizeof buf) == "8=FIX.4.4\x01" "34=99999999\x01" "55=ABCDEFGH\x01");
+        assert(order_header::fill(buf, 0, ""));
+        assert(std::string_view(buf, sizeof buf) == "8=FIX.4.4\x01" "34=00000000\x01" "55=        \x01");
+
+        // Values that don't fit are reported
+        assert(!order_header::fill(buf, 100000000, "AAPL"));
+        assert(!order_header::fill(buf, -1, "AAPL"));
+        assert(!order_header::fill(buf, 1, "ABCDEFGHI"));
+    }
+
+    // Binary slots
+    {
+        std::vector<std::byte> buf(binary_header::size);
+        assert(binary_header::build(buf.data(), 0x0102, msg_type::add, 0x030405, std::int64_t{ -2 }));
+        assert(buf == bytes(0xCA, 0xFE, 0x01, 0x02, 'A', 0x05, 0x04, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF));
+
+        // The edges of each slot's range: unsigned values up to 2^bits - 1, signed ones down to -2^(bits - 1)
+        assert(binary_header::fill(buf.data(), 0xFFFFu, std::uint8_t{ 0xFF }, -0x800000, 0));
+        assert(buf == bytes(0xCA, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0, 0, 0, 0, 0, 0, 0, 0));
+        assert(!binary_header::fill(buf.data(), 0xFFFF, 0, 0, 0)); // Signed, so it would read back as -1
+        assert(!binary_header::fill(buf.data(), 0x10000u, 0, 0, 0));
+        assert(!binary_header::fill(buf.data(), 0, 0x100u, 0, 0));
+        assert(!binary_header::fill(buf.data(), 0, 0, -0x800001, 0));
+        assert(!binary_header::fill(buf.data(), 0, 0, 0x1000000, 0));
+    }
+}
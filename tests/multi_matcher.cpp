@@ -0,0 +1,45 @@
+#include <uninttp/multi_matcher.hpp>
+#include <cassert>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace uninttp;
+
+using classic = multi_matcher<"he", "she", "his", "hers">;
+
+/* Feeds `chunks` one after another, collecting (pattern, offset) pairs */
+template <typename Matcher, typename... Chunks>
+constexpr auto matches(Chunks... chunks) {
+    Matcher m;
+    std::vector<std::pair<std::size_t, std::size_t>> out;
+    (m.feed(chunks, [&](const std::size_t p, const std::size_t at) { out.emplace_back(p, at); }), ...);
+    return out;
+}
+
+static_assert(classic::size() == 4);
+static_assert(classic::pattern(2) == "his");
+static_assert(matches<classic>("ushers") == std::vector<std::pair<std::size_t, std::size_t>> { { 1, 1 }, { 0, 2 }, { 3, 2 } });
+static_assert(matches<classic>("ush", "ers") == matches<classic>("ushers"));
+static_assert(matches<classic>("u", "s", "h", "e", "r", "s") == matches<classic>("ushers"));
+static_assert(matches<classic>("nothing to see").empty());
+
+// Overlapping occurrences of one pattern are all reported
+static_assert(matches<multi_matcher<"aa">>("aaaa") == std::vector<std::pair<std::size_t, std::size_t>> { { 0, 0 }, { 0, 1 }, { 0, 2 } });
+
+// Bytes outside of the patterns' alphabet (including high ones) reset the match
+static_assert(matches<multi_matcher<"ab">>("a\xFF" "bab") == std::vector<std::pair<std::size_t, std::size_t>> { { 0, 3 } });
+
+int main() {
+    classic m;
+    std::size_t seen = 0;
+    assert(!m.feed("ushers", [&](std::size_t, std::size_t) { return ++seen < 2; }));
+    assert(seen == 2 && m.offset() == 4);
+
+    m.reset();
+    assert(m.offset() == 0);
+    std::vector<std::size_t> offsets;
+    m.feed("she", [&](std::size_t, const std::size_t at) { offsets.push_back(at); });
+    m.feed("his", [&](std::size_t, const std::size_t at) { offsets.push_back(at); });
+    assert((offsets == std::vector<std::size_t> { 0, 1, 3 }));
+}
@@ -0,0 +1,78 @@
+#include <uninttp/packet_parser.hpp>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+using namespace uninttp;
+
+enum class side : char { buy = 'B', sell = 'S' };
+
+// Shaped like an ITCH "add order" message, plus a few fields to cover the other kinds of members
+struct add_order {
+    std::uint64_t timestamp;
+    std::uint16_t locate;
+    side s;
+    std::uint32_t shares;
+    char stock[8];
+    std::int32_t offset;
+    float weight;
+    bool flag;
+};
+
+using add_order_parser = packet_parser<packet_field<5, 6, std::endian::big, &add_order::timestamp>,
+                                       packet_field<1, 2, std::endian::big, &add_order::locate>,
+                                       packet_field<19, 1, std::endian::big, &add_order::s>,
+                                       packet_field<20, 4, std::endian::big, &add_order::shares>,
+                                       packet_field<24, 8, std::endian::big, &add_order::stock>,
+                                       packet_field<32, 3, std::endian::little, &add_order::offset>,
+                                       packet_field<35, 4, std::endian::little, &add_order::weight>,
+                                       packet_field<39, 1, std::endian::big, &add_order::flag>>;
+
+static_assert(add_order_parser::size == 40);
+
+template <typename... Bytes>
+static std::vector<std::byte> bytes(const Bytes... b) {
+    return { static_cast<std::byte>(b)... };
+}
+
+int main() {
+    const auto message = bytes('A', 0x12, 0x34, 0, 0,                 // Type, locate, tracking number
+                               0x01, 0x02, 0x03, 0x04, 0x05, 0x06,    // Timestamp
+                               0, 0, 0, 0, 0, 0, 0, 0,                // Order reference number, not parsed
+                               'S', 0x00, 0x01, 0x86, 0xA0,           // Side, shares
+                               'A', 'A', 'P', 'L', ' ', ' ', ' ', ' ',
+                               0xFE, 0xFF, 0xFF,                      // -2 in 3 little-endian bytes
+                               0x00, 0x00, 0xC0, 0x3F,                // 1.5f in little-endian
+                               0x02);                                 // Any non-zero value is true
+
+    {
+        add_order o{};
+        assert(add_order_parser::parse(message.data(), message.data() + message.size(), o));
+        assert(o.timestamp == 0x010203040506 && o.locate == 0x1234 && o.s == side::sell && o.shares == 100000);
+        assert(std::memcmp(o.stock, "AAPL    ", 8) == 0 && o.offset == -2 && o.weight == 1.5f && o.flag);
+    }
+
+    // A view decodes the same values on access, and gives char arrays as views into the message
+    {
+        const auto v = add_order_parser::view_of(message.data(), message.data() + message.size());
+        assert(v && v->data() == message.data());
+        assert(v->get<&add_order::timestamp>() == 0x010203040506 && v->get<&add_order::offset>() == -2);
+        assert(v->get<&add_order::stock>() == "AAPL    " && v->get<&add_order::stock>().data() == reinterpret_cast<const char*>(message.data() + 24));
+        assert(v->get<&add_order::s>() == side::sell && v->get<&add_order::weight>() == 1.5f);
+    }
+
+    // Sign extension only applies to signed members narrower on the wire
+    {
+        auto copy = message;
+        copy[34] = std::byte{ 0x7F };
+        assert(add_order_parser::view_of(copy.data(), copy.data() + copy.size())->get<&add_order::offset>() == 0x7FFFFE);
+    }
+
+    // Messages that are too short are refused, and leave the output alone
+    {
+        add_order o{};
+        o.shares = 7;
+        assert(!add_order_parser::parse(message.data(), message.data() + message.size() - 1, o) && o.shares == 7);
+        assert(!add_order_parser::view_of(message.data(), message.data() + message.size() - 1));
+    }
+}
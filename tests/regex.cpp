@@ -0,0 +1,63 @@
+#include <uninttp/regex.hpp>
+#include <cassert>
+#include <string>
+
+using namespace uninttp;
+
+// Literals, `.`, classes and escapes
+static_assert(regex<"abc">::match("abc") && !regex<"abc">::match("abcd") && !regex<"abc">::match("ab"));
+static_assert(regex<"a.c">::match("a-c") && !regex<"a.c">::match("ac"));
+static_assert(regex<"[a-c]+">::match("abcba") && !regex<"[a-c]+">::match("abd"));
+static_assert(regex<"[^0-9]">::match("x") && !regex<"[^0-9]">::match("5"));
+static_assert(regex<"\\d\\w\\s">::match("1_ ") && !regex<"\\d\\w\\s">::match("a_ "));
+static_assert(regex<"\\D\\W\\S">::match("a-x") && !regex<"\\D\\W\\S">::match("1-x"));
+static_assert(regex<"a\\.b\\t">::match("a.b\t") && !regex<"a\\.b\\t">::match("axb\t"));
+
+// Quantifiers and alternation
+static_assert(regex<"ab*c">::match("ac") && regex<"ab*c">::match("abbbc"));
+static_assert(regex<"ab+c">::match("abc") && !regex<"ab+c">::match("ac"));
+static_assert(regex<"colou?r">::match("color") && regex<"colou?r">::match("colour"));
+static_assert(regex<"a{2,3}">::match("aa") && regex<"a{2,3}">::match("aaa") && !regex<"a{2,3}">::match("a") && !regex<"a{2,3}">::match("aaaa"));
+static_assert(regex<"a{2}">::match("aa") && !regex<"a{2}">::match("aaa"));
+static_assert(regex<"a{2,}">::match("aaaaa") && !regex<"a{2,}">::match("a"));
+static_assert(regex<"cat|dog|(?:bird)s">::match("dog") && regex<"cat|dog|(?:bird)s">::match("birds") && !regex<"cat|dog|(?:bird)s">::match("bird"));
+static_assert(regex<"">::match("") && !regex<"">::match("a"));
+
+// Search: leftmost, then longest; anchors
+static_assert(*regex<"a+">::search("xxaaay") == "aaa");
+static_assert(*regex<"ab|abcd">::search("zabcd") == "abcd");
+static_assert(!regex<"q">::search("abc"));
+static_assert(*regex<"x*">::search("abc") == "");
+static_assert(*regex<"^ab">::search("abab") == "ab" && !regex<"^ab">::search("cab"));
+static_assert(*regex<"ab$">::search("abab") == "ab" && !regex<"ab$">::search("aba"));
+// Anchors apply to the whole pattern, so alternatives next to them must be grouped (`^a|b$` doesn't compile)
+static_assert(regex<"^(?:a|b)$">::search("b").has_value() && !regex<"^(?:a|b)$">::search("xb") && !regex<"^(?:a|b)$">::search("ab"));
+static_assert(*regex<"^(a|bc)">::search("bcx") == "bc" && !regex<"^(a|bc)">::search("xa"));
+static_assert(*regex<"(?:a|b)+$">::search("xab") == "ab" && *regex<"x(a|b)$">::search("xaxb") == "xb");
+
+// Submatches, resolved like a backtracking engine would
+using email = regex<"([a-z]+)@([a-z]+)\\.com">;
+static_assert(email::group_count() == 2);
+static_assert((*email::search_groups("mail foo@bar.com now"))[0] == "foo@bar.com");
+static_assert((*email::search_groups("mail foo@bar.com now"))[1] == "foo");
+static_assert((*email::match_groups("a@b.com"))[2] == "b");
+static_assert(!email::match_groups("a@b.org"));
+static_assert((*regex<"(a*)(a*)">::match_groups("aaa"))[1] == "aaa");
+static_assert((*regex<"(a|ab)(c|bcd)">::match_groups("abcd"))[2] == "bcd");
+static_assert((*regex<"(?:(a)|b)+">::match_groups("ab"))[1] == "a");
+static_assert((*regex<"(x)?y">::match_groups("y"))[1].data() == nullptr);
+
+// Escaping a literal yields a pattern matching exactly that literal
+static_assert(regex<regex_escaped_v<"1+1=2? (yes) [x] {3} a|b ^$ \\ .*">>::match("1+1=2? (yes) [x] {3} a|b ^$ \\ .*"));
+static_assert(!regex<regex_escaped_v<"a.c">>::match("abc"));
+
+int main() {
+    // The same checks, on strings only known at runtime
+    const std::string text = "id=4711; id=42";
+    using id = regex<"id=(\\d+)">;
+    const auto g = id::search_groups(text);
+    assert(g && (*g)[1] == "4711");
+    assert(id::search(std::string_view { text }.substr(8)) == "id=42");
+    std::string high = "\xC3\xA9t\xC3\xA9";
+    assert(regex<"\xC3\xA9.*">::match(high) && !regex<"[a-z]+">::match(high));
+}
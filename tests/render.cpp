@@ -0,0 +1,81 @@
+#include <uninttp/render.hpp>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <version>
+#include <string>
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+
+using namespace uninttp;
+
+enum class level : signed char { low = -3, high = 12 };
+
+constexpr unsigned char calibration[] = { 0x1f, 0x80, 0xc3 };
+constexpr int table[] = { 1, -20, 300 };
+constexpr char name[8] = "probe";
+constexpr bool switches[] = { true, false };
+constexpr level levels[] = { level::low, level::high };
+
+// Integers: bases, alternate forms, signs, fills and alignments, and zero padding that goes after the sign and prefix
+static_assert(render_v<0> == "0" && render_v<-2147483647 - 1> == "-2147483648" && render_v<18446744073709551615ull> == "18446744073709551615");
+static_assert(render_v<255, "x"> == "ff" && render_v<255, "#X"> == "0XFF" && render_v<5, "#b"> == "0b101" && render_v<8, "#o"> == "010");
+static_assert(render_v<-255, "#010x"> == "-0x00000ff" && render_v<42, "+"> == "+42" && render_v<42, " "> == " 42");
+static_assert(render_v<42, "*^7"> == "**42***" && render_v<42, "<5"> == "42   " && render_v<-42, "6"> == "   -42" && render_v<65, "c"> == "A");
+
+// Characters, bool and enumerations
+static_assert(render_v<'x'> == "x" && render_v<'x', "d"> == "120" && render_v<'x', "^3"> == " x ");
+static_assert(render_v<'\xC3'> == "\xC3" && render_v<'\xC3', "c"> == "\xC3" && render_v<'\xC3', "*<2"> == "\xC3*");
+static_assert(render_v<static_cast<unsigned char>(200), "c"> == "\xC8" && render_v<-1, "c"> == "\xFF" && render_v<255u, "c"> == "\xFF");
+static_assert(render_v<true> == "true" && render_v<false, "d"> == "0" && render_v<true, ">6"> == "  true");
+static_assert(render_v<level::low> == "-3" && render_v<level::high, "02x"> == "0c");
+
+// Strings, including precision, and character arrays cut at their null terminator
+static_assert(render_v<"hello", ".3"> == "hel" && render_v<"hi", "-^6"> == "--hi--" && render_v<name> == "probe" && render_v<""> == "");
+
+// Arrays as ranges
+static_assert(render_v<calibration, "n:02x"> == "1f, 80, c3" && render_v<calibration> == "[31, 128, 195]");
+static_assert(render_v<table, ":+"> == "[+1, -20, +300]" && render_v<table, "n"> == "1, -20, 300");
+static_assert(render_v<switches> == "[true, false]" && render_v<levels, ":>3"> == "[ -3,  12]");
+
+// The shortest form that reads back the same, in fixed or scientific notation, whichever is shorter (fixed on a tie), like std::to_chars()
+static_assert(render_v<0.1> == "0.1" && render_v<1.0 / 3> == "0.3333333333333333" && render_v<-0.0> == "-0" && render_v<100.0> == "100");
+static_assert(render_v<123456.0> == "123456" && render_v<1e21> == "1e+21" && render_v<1e16> == "1e+16" && render_v<0.001> == "0.001" && render_v<1e-5> == "1e-05");
+static_assert(render_v<5e-324> == "5e-324" && render_v<std::numeric_limits<double>::max()> == "1.7976931348623157e+308");
+static_assert(render_v<0.1f> == "0.1" && render_v<16777216.0f> == "16777216" && render_v<std::numeric_limits<float>::max()> == "3.4028235e+38");
+static_assert(render_v<std::numeric_limits<double>::infinity()> == "inf" && render_v<-std::numeric_limits<double>::infinity(), "F"> == "-INF");
+static_assert(render_v<std::numeric_limits<double>::quiet_NaN()> == "nan");
+
+// Precision, correctly rounded from the exact binary value (half to even when it's exactly halfway)
+static_assert(render_v<2.675, ".2f"> == "2.67" && render_v<0.5, ".0f"> == "0" && render_v<1.5, ".0f"> == "2" && render_v<2.5, ".0f"> == "2");
+static_assert(render_v<0.1, ".17g"> == "0.10000000000000001" && render_v<0.1, ".30f"> == "0.100000000000000005551115123126");
+static_assert(render_v<1e22, ".3f"> == "10000000000000000000000.000" && render_v<9.96, ".1e"> == "1.0e+01");
+static_assert(render_v<12345.678, ".3e"> == "1.235e+04" && render_v<1.5, "E"> == "1.500000E+00" && render_v<1.5> != render_v<1.5, "f">);
+
+// General format, and the alternate form keeping the decimal point and trailing zeros
+static_assert(render_v<1e-5, "g"> == "1e-05" && render_v<0.0001, "g"> == "0.0001" && render_v<123456789.0, "g"> == "1.23457e+08" && render_v<100000.0, "g"> == "100000");
+static_assert(render_v<1.0, "#g"> == "1.00000" && render_v<5.0, ".0e"> == "5e+00" && render_v<5.0, "#.0e"> == "5.e+00" && render_v<3.0, "#.0f"> == "3.");
+
+// Sign, zero padding, fill, alignment and width
+static_assert(render_v<-3.14159, "+08.2f"> == "-0003.14" && render_v<3.14159, "+08.2f"> == "+0003.14" && render_v<1.0, " "> == " 1");
+static_assert(render_v<2.25, "*>8.1f"> == "*****2.2" && render_v<0.0001234, "10.3g"> == "  0.000123" && render_v<0.5, "<6"> == "0.5   ");
+
+// The text is null-terminated
+static_assert(render_v<calibration, "n:02x">.data()[render_v<calibration, "n:02x">.size()] == '\0');
+
+#ifdef __cpp_lib_format
+template <uni_auto Table, uni_auto Name>
+void dump(std::string& out) {
+    std::format_to(std::back_inserter(out), "{}|{:n:#04x}|{:>7}", Table, Table, Name);
+}
+#endif
+
+int main() {
+#ifdef __cpp_lib_format
+    // The runtime formatter of uni_auto formats arrays as ranges too, and agrees with render_v; character arrays are still strings
+    std::string out;
+    dump<calibration, name>(out);
+    assert(out == std::string(render_v<calibration>) + "|0x1f, 0x80, 0xc3|  probe");
+#endif
+}
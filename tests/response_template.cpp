@@ -0,0 +1,75 @@
+#include <uninttp/response_template.hpp>
+#include <cassert>
+#include <string>
+#include <string_view>
+
+using namespace uninttp;
+
+// Shaped like POSIX `iovec`, which is all that `fill()` needs
+struct io_vector {
+    void* iov_base;
+    std::size_t iov_len;
+};
+
+using ok_response = response_template<"HTTP/1.1 200 OK\r\nContent-Length: {}\r\n\r\n{}">;
+using braces = response_template<"{{{}}}{}{{}}">;
+using constant = response_template<"no placeholders">;
+using empty = response_template<"">;
+
+static_assert(ok_response::segment_count == 4 && ok_response::placeholder_count == 2);
+static_assert(braces::segment_count == 5 && braces::placeholder_count == 2);
+static_assert(constant::segment_count == 1 && constant::placeholder_count == 0);
+static_assert(empty::segment_count == 0 && empty::placeholder_count == 0);
+
+template <std::size_t N>
+static std::string gather(const io_vector (&iov)[N]) {
+    std::string out;
+    for (const auto& v : iov)
+        out.append(static_cast<const char*>(v.iov_base), v.iov_len);
+    return out;
+}
+
+enum class code : short { teapot = 418 };
+
+int main() {
+    // Constant text and strings are referred to in place; only numbers use the scratch space
+    {
+        const std::string body = "hello";
+        io_vector iov[ok_response::segment_count];
+        char scratch[8];
+        const auto total = ok_response::fill(iov, scratch, scratch + sizeof scratch, body.size(), body);
+        assert(total && *total == 43);
+        assert(gather(iov) == "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello");
+        assert(iov[1].iov_base == scratch && iov[3].iov_base == body.data());
+    }
+
+    // Literal braces, characters, bools, enumerations and floating-point numbers
+    {
+        io_vector iov[braces::segment_count];
+        char scratch[16];
+        assert(braces::fill(iov, scratch, scratch + sizeof scratch, 'x', true) == 9u);
+        assert(gather(iov) == "{x}true{}");
+        assert(braces::fill(iov, scratch, scratch + sizeof scratch, code::teapot, -0.5) == 11u);
+        assert(gather(iov) == "{418}-0.5{}");
+    }
+
+    // Empty output and empty (even null) strings aren't mistaken for running out of scratch space
+    {
+        io_vector iov[braces::segment_count];
+        assert(braces::fill(iov, nullptr, nullptr, std::string_view{}, "") == 4u);
+        assert(gather(iov) == "{}{}");
+        io_vector none[1];
+        assert(empty::fill(none, nullptr, nullptr) == 0u);
+        assert(constant::fill(none, nullptr, nullptr) == 15u && gather(none) == "no placeholders");
+    }
+
+    // Running out of scratch space
+    {
+        io_vector iov[ok_response::segment_count];
+        char scratch[4];
+        assert(ok_response::fill(iov, scratch, scratch + 4, 1234, "") == 41u);
+        assert(!ok_response::fill(iov, scratch, scratch + 4, 12345, ""));
+        assert(!braces::fill(iov, scratch, scratch + 1, 'a', 'b'));
+        assert(!braces::fill(iov, scratch, scratch, 'a', ""));
+    }
+}
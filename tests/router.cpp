@@ -0,0 +1,143 @@
+#include <uninttp/router.hpp>
+#include <cassert>
+#include <string>
+
+using namespace uninttp;
+
+constexpr auto get_order = [](std::string& out, const std::string_view id) { out = "order " + std::string(id); };
+constexpr auto get_item = [](std::string& out, const std::string_view id, const std::string_view item) {
+    out = "item " + std::string(item) + " of " + std::string(id);
+};
+constexpr auto health = [](std::string& out) { out = "ok"; };
+constexpr auto list_orders = [](std::string& out) { out = "all orders"; };
+constexpr auto get_latest = [](std::string& out) { out = "latest"; };
+constexpr auto get_status = [](std::string& out, const std::string_view kind, const std::string_view id) {
+    out = "status of " + std::string(kind) + " " + std::string(id);
+};
+
+using api = router<
+    route<"/v1/orders/{id}", get_order>,
+    route<"/v1/orders/{id}/items/{item}", get_item>,
+    route<"/v1/health", health>,
+    route<"/v1/orders", list_orders>,
+    route<"/v1/orders/latest", get_latest>,
+    route<"/v1/{kind}/{id}/status", get_status>
+>;
+
+static_assert(api::route_count == 6);
+static_assert(api::max_parameters == 2);
+
+constexpr auto index_of(const std::string_view path) {
+    std::array<std::string_view, api::max_parameters> parameters{};
+    return api::match(path, parameters);
+}
+
+constexpr auto parameter(const std::string_view path, const std::size_t i) {
+    std::array<std::string_view, api::max_parameters> parameters{};
+    api::match(path, parameters);
+    return parameters[i];
+}
+
+// Matching
+static_assert(index_of("/v1/orders/42") == 0);
+static_assert(index_of("/v1/orders/42/items/7") == 1);
+static_assert(index_of("/v1/health") == 2);
+static_assert(index_of("/v1/orders") == 3);
+static_assert(parameter("/v1/orders/42/items/7", 0) == "42");
+static_assert(parameter("/v1/orders/42/items/7", 1) == "7");
+
+// Literal segments take precedence, and matching backs off to a parameter where a literal leads nowhere
+static_assert(index_of("/v1/orders/latest") == 4);
+static_assert(index_of("/v1/orders/latest/items/3") == 1);
+static_assert(parameter("/v1/orders/latest/items/3", 0) == "latest");
+static_assert(index_of("/v1/orders/42/status") == 5);
+static_assert(parameter("/v1/orders/42/status", 0) == "orders");
+static_assert(parameter("/v1/orders/42/status", 1) == "42");
+static_assert(index_of("/v1/health/1/status") == 5);
+
+// The query string is ignored
+static_assert(index_of("/v1/orders/42?verbose=1") == 0);
+static_assert(parameter("/v1/orders/42?verbose=1", 0) == "42");
+static_assert(index_of("/v1/health?") == 2);
+
+// No match
+static_assert(index_of("") == api::route_count);
+static_assert(index_of("v1/health") == api::route_count);
+static_assert(index_of("/") == api::route_count);
+static_assert(index_of("/v1") == api::route_count);
+static_assert(index_of("/v1/") == api::route_count);
+static_assert(index_of("/v1/orders/") == api::route_count); // A parameter never matches an empty segment
+static_assert(index_of("/v1/orders//items/7") == api::route_count);
+static_assert(index_of("/v1/health/") == api::route_count);
+static_assert(index_of("/v1/healthz") == api::route_count);
+static_assert(index_of("/v1/orders/42/items") == api::route_count);
+static_assert(index_of("/v1/orders/42/items/7/8") == api::route_count);
+static_assert(index_of("/v2/orders/42") == api::route_count);
+
+// A router with handlers that return something
+constexpr auto square = [](const int x) { return x * x; };
+constexpr auto length = [](int, const std::string_view name) { return static_cast<int>(name.size()); };
+
+using calc = router<route<"/square", square>, route<"/length/{name}", length>>;
+
+static_assert(calc::max_parameters == 1);
+static_assert(calc::dispatch("/square", 7) == 49);
+static_assert(calc::dispatch("/length/abcd", 0) == 4);
+static_assert(!calc::dispatch("/cube", 7).has_value());
+
+// A route at the root, and routes that share no segment
+using root = router<route<"/", square>, route<"/{x}", length>>;
+
+static_assert(root::dispatch("/", 3) == 9);
+static_assert(root::dispatch("/abc", 3) == 3);
+static_assert(!root::dispatch("/abc/def", 3).has_value());
+
+// No literal segments at all, so nothing to hash
+using anything = router<route<"/{x}", length>>;
+
+static_assert(anything::dispatch("/abc", 0) == 3);
+static_assert(!anything::dispatch("/", 0).has_value());
+
+// Enough literal edges that the hash has to tell apart segments sharing their ends
+using many = router<
+    route<"/aa", square>, route<"/ab", square>, route<"/ba", square>, route<"/bb", square>,
+    route<"/a/a", square>, route<"/a/b", square>, route<"/b/a", square>, route<"/b/b", square>,
+    route<"/axxa", square>, route<"/axya", square>, route<"/ayxa", square>, route<"/ayya", square>
+>;
+
+constexpr auto many_index(const std::string_view path) {
+    std::array<std::string_view, many::max_parameters> parameters{};
+    return many::match(path, parameters);
+}
+
+static_assert(many_index("/aa") == 0 && many_index("/ab") == 1 && many_index("/ba") == 2 && many_index("/bb") == 3);
+static_assert(many_index("/a/a") == 4 && many_index("/a/b") == 5 && many_index("/b/a") == 6 && many_index("/b/b") == 7);
+static_assert(many_index("/axxa") == 8 && many_index("/axya") == 9 && many_index("/ayxa") == 10 && many_index("/ayya") == 11);
+static_assert(many_index("/azza") == many::route_count && many_index("/a") == many::route_count && many_index("/c/a") == many::route_count);
+
+int main() {
+    // Handlers returning `void`
+    std::string out;
+    assert(api::dispatch("/v1/orders/42", out) && out == "order 42");
+    assert(api::dispatch("/v1/orders/42/items/7?x=y", out) && out == "item 7 of 42");
+    assert(api::dispatch("/v1/health", out) && out == "ok");
+    assert(api::dispatch("/v1/orders", out) && out == "all orders");
+    assert(api::dispatch("/v1/orders/latest", out) && out == "latest");
+    assert(api::dispatch("/v1/users/x/status", out) && out == "status of users x");
+    out = "untouched";
+    assert(!api::dispatch("/v1/orders/", out) && out == "untouched");
+    assert(!api::dispatch("/nowhere", out) && out == "untouched");
+
+    // The parameters point into the path
+    const std::string path = "/v1/orders/1234/items/56";
+    std::array<std::string_view, api::max_parameters> parameters{};
+    assert(api::match(path, parameters) == 1);
+    assert(parameters[0].data() == path.data() + 11 && parameters[0].size() == 4);
+    assert(parameters[1].data() == path.data() + 22 && parameters[1].size() == 2);
+
+    // A route's handler can be called on its own
+    route<"/v1/orders/{id}", get_order>::call(parameters.data(), out);
+    assert(out == "order 1234");
+    static_assert(route<"/v1/orders/{id}/items/{item}", get_item>::parameter_count == 2);
+    static_assert(route<"/v1/health", health>::parameter_count == 0);
+}
@@ -0,0 +1,13 @@
+#!/bin/sh
+# Builds and runs every test program in this directory; `CXX`, `CXXFLAGS` and `LDFLAGS` are honoured.
+set -e
+cd "$(dirname "$0")/.."
+CXX=${CXX:-c++}
+out=${TMPDIR:-/tmp}/uninttp-tests
+mkdir -p "$out"
+for test in tests/*.cpp; do
+    name=$(basename "$test" .cpp)
+    $CXX -std=c++20 -Wall -Wextra -Wshadow -pthread -I. $CXXFLAGS "$test" -o "$out/$name" $LDFLAGS
+    "$out/$name"
+    echo "passed: $name"
+done
@@ -0,0 +1,115 @@
+#include <uninttp/time_format.hpp>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace uninttp;
+using namespace std::chrono;
+
+using iso = time_format<"%Y-%m-%dT%H:%M:%S.%f">;
+using millis = time_format<"%Y%m%d %H%M%S%3f">;
+using nanos = time_format<"[%%%9f%%]">;
+using clock_only = time_format<"%H:%M">;
+using iso_nanos = time_format<"%Y-%m-%dT%H:%M:%S.%9f">;
+
+static_assert(iso::size == 26 && std::is_same_v<iso::duration, microseconds>);
+static_assert(millis::size == 18 && std::is_same_v<millis::duration, milliseconds>);
+static_assert(nanos::size == 13 && std::is_same_v<nanos::duration, nanoseconds>);
+static_assert(clock_only::size == 5 && std::is_same_v<clock_only::duration, seconds>);
+
+template <typename Format>
+static std::string print(const typename Format::time_point t) {
+    char buf[Format::size];
+    const auto [end, ec] = Format::print(buf, buf + sizeof buf, t);
+    assert(ec == std::errc{} && end == buf + sizeof buf);
+    return { buf, sizeof buf };
+}
+
+template <typename Format>
+static typename Format::time_point parse(const std::string_view s) {
+    typename Format::time_point t;
+    const auto [end, ec] = Format::parse(s.data(), s.data() + s.size(), t);
+    assert(ec == std::errc{} && end == s.data() + Format::size);
+    return t;
+}
+
+template <typename Format>
+static bool parses(const std::string_view s) {
+    typename Format::time_point t;
+    return Format::parse(s.data(), s.data() + s.size(), t).ec == std::errc{};
+}
+
+int main() {
+    // Every third day of years 0000 through 9999 (which lands on every day of the year, and on a third of the leap days) against std::chrono's
+    // calendar, at a time of day that varies from one day to the next
+    for (auto d = sys_days { year { 0 } / 1 / 1 }; d <= sys_days { year { 9999 } / 12 / 31 }; d += days { 3 }) {
+        const auto n = d.time_since_epoch().count() + 719528; // Days since 0000-01-01, so never negative
+        const auto t = time_point_cast<microseconds>(d) + seconds { n * 7919 % 86400 } + microseconds { n * 104729 % 1000000 };
+        const year_month_day ymd { d };
+        const hh_mm_ss hms { t - d };
+        char expected[64];
+        std::snprintf(expected, sizeof expected, "%04d-%02u-%02uT%02lld:%02lld:%02lld.%06lld", static_cast<int>(ymd.year()), static_cast<unsigned>(ymd.month()),
+                      static_cast<unsigned>(ymd.day()), static_cast<long long>(hms.hours().count()), static_cast<long long>(hms.minutes().count()),
+                      static_cast<long long>(hms.seconds().count()), static_cast<long long>(hms.subseconds().count()));
+        assert(print<iso>(t) == expected);
+        assert(parse<iso>(expected) == t);
+    }
+
+    // Other precisions and literal text, including %%
+    assert(print<millis>(sys_days { year { 2024 } / 2 / 29 } + hours { 23 } + minutes { 59 } + seconds { 58 } + milliseconds { 7 }) == "20240229 235958007");
+    assert(parse<nanos>("[%000000042%]") == sys_time<nanoseconds> { nanoseconds { 42 } });
+    assert(print<nanos>(sys_days { year { 2001 } / 1 / 1 } + nanoseconds { 999999999 }) == "[%999999999%]");
+
+    // Missing date fields default to 1970-01-01
+    assert(parse<clock_only>("13:37") == sys_seconds { hours { 13 } + minutes { 37 } });
+
+    // Malformed or impossible timestamps
+    assert(parses<iso>("2000-02-29T00:00:00.000000") && !parses<iso>("1900-02-29T00:00:00.000000") && !parses<iso>("2023-02-29T00:00:00.000000"));
+    assert(parses<iso>("2023-04-30T23:59:59.999999") && !parses<iso>("2023-04-31T00:00:00.000000") && parses<iso>("2023-12-31T00:00:00.000000"));
+    for (const auto s : { "2023-00-01T00:00:00.000000", "2023-13-01T00:00:00.000000", "2023-01-00T00:00:00.000000", "2023-01-32T00:00:00.000000",
+                          "2023-01-01T24:00:00.000000", "2023-01-01T00:60:00.000000", "2023-01-01T00:00:60.000000", "2023-01-01 00:00:00.000000",
+                          "2023-01-01T00:00:00,000000", "2023-01-0aT00:00:00.000000", "2023-01-01T00:00:00.00000-", "2023-01-01T00:00:00.00000" })
+        assert(!parses<iso>(s));
+    assert(!parses<nanos>("[%000000042]]") && !parses<nanos>("[x000000042%]"));
+
+    // Nanoseconds only cover 1677-09-21T00:12:43.145224192 through 2262-04-11T23:47:16.854775807; anything past either end is rejected
+    for (const auto s : { "1677-09-21T00:12:43.145224192", "2262-04-11T23:47:16.854775807", "1970-01-01T00:00:00.000000000", "2262-04-11T23:47:15.999999999" })
+        assert(print<iso_nanos>(parse<iso_nanos>(s)) == s);
+    assert(parse<iso_nanos>("2262-04-11T23:47:16.854775807") == sys_time<nanoseconds>::max());
+    assert(parse<iso_nanos>("1677-09-21T00:12:43.145224192") == sys_time<nanoseconds>::min());
+    for (const auto s : { "1677-09-21T00:12:43.145224191", "1677-09-21T00:12:42.999999999", "1677-09-20T23:59:59.999999999", "0000-01-01T00:00:00.000000000",
+                          "2262-04-11T23:47:16.854775808", "2262-04-11T23:47:17.000000000", "2300-01-01T00:00:00.000000000", "9999-12-31T23:59:59.999999999" })
+        assert(!parses<iso_nanos>(s));
+    {
+        const std::string column = "2262-04-11T23:47:16.854775807|2300-01-01T00:00:00.000000000|";
+        std::vector<iso_nanos::time_point> out(2);
+        assert(iso_nanos::parse(column.data(), iso_nanos::size + 1, 2, out.data()) == 1 && out[0] == sys_time<nanoseconds>::max());
+    }
+
+    // Columns of fixed-width records stop at the first bad row, even within a block
+    {
+        std::string column;
+        for (int i = 0; i < 20; i++)
+            column += print<iso>(sys_days { year { 2020 } / 1 / 1 } + seconds { i }) + ";";
+        std::vector<iso::time_point> out(20);
+        assert(iso::parse(column.data(), iso::size + 1, 20, out.data()) == 20);
+        for (int i = 0; i < 20; i++)
+            assert(out[i] == sys_days { year { 2020 } / 1 / 1 } + seconds { i });
+        column[11 * (iso::size + 1) + 5] = '1'; // Month 01 becomes 11, which is still fine
+        assert(iso::parse(column.data(), iso::size + 1, 20, out.data()) == 20);
+        column[11 * (iso::size + 1) + 6] = '3'; // Month 13
+        assert(iso::parse(column.data(), iso::size + 1, 20, out.data()) == 11);
+    }
+
+    // Printing refuses buffers that are too small and years outside 0000-9999
+    {
+        char buf[iso::size];
+        const iso::time_point t { microseconds { 0 } };
+        assert(iso::print(buf, buf + sizeof buf - 1, t).ec == std::errc::value_too_large);
+        assert(iso::print(buf, buf + sizeof buf, sys_days { year { 10000 } / 1 / 1 }).ec == std::errc::value_too_large);
+        assert(iso::print(buf, buf + sizeof buf, sys_days { year { -1 } / 12 / 31 }).ec == std::errc::value_too_large);
+    }
+}
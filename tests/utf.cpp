@@ -0,0 +1,34 @@
+#include <uninttp/utf.hpp>
+#include <cassert>
+#include <cstring>
+
+using namespace uninttp;
+
+// Every direction, across the one- to four-byte UTF-8 sequences (and a UTF-16 surrogate pair)
+static_assert(uni_auto_sv<utf16_v<u8"aé€😀">> == u"aé€😀");
+static_assert(uni_auto_sv<utf32_v<u8"aé€😀">> == U"aé€😀");
+static_assert(uni_auto_sv<utf8_v<u"aé€😀">> == u8"aé€😀");
+static_assert(uni_auto_sv<utf8_v<U"aé€😀">> == u8"aé€😀");
+static_assert(uni_auto_sv<utf16_v<U"😀">>.size() == 2);
+static_assert(uni_auto_sv<utf32_v<"plain">> == U"plain");
+static_assert(uni_auto_sv<utf8_v<u"">>.empty());
+
+// Well-formedness
+static_assert(utf8_valid_v<"\xC3\xA9"> && utf8_valid_v<"\xF4\x8F\xBF\xBF">);
+static_assert(!utf8_valid_v<"\xC3"> && !utf8_valid_v<"\x80">);
+static_assert(!utf8_valid_v<"\xC0\xAF">);            // Overlong encoding
+static_assert(!utf8_valid_v<"\xED\xA0\x80">);        // Encoded surrogate
+static_assert(!utf8_valid_v<"\xF4\x90\x80\x80">);    // Past U+10FFFF
+static_assert(utf_valid_v<u"\xD83D\xDE00"> && !utf_valid_v<u"\xD83D"> && !utf_valid_v<u"\xDE00x">);
+static_assert(utf_valid_v<U"\x10FFFF"> && !utf_valid_v<U"\x110000"> && !utf_valid_v<U"\xD800">);
+
+int main() {
+    // The results are null-terminated, so they can be handed to C APIs as they are
+    constexpr auto wide = utf16_v<"naïve">;
+    std::size_t n = 0;
+    while (wide.data()[n] != 0)
+        n++;
+    assert(n == 5);
+    const auto narrow = utf8_v<U"naïve">;
+    assert(std::strlen(reinterpret_cast<const char*>(narrow.data())) == 6);
+}
@@ -0,0 +1,131 @@
+#include <uninttp/wire_codec.hpp>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace uninttp;
+
+// The examples from the Protocol Buffers encoding guide
+struct test1 {
+    int a;
+};
+
+struct test2 {
+    std::string_view b;
+};
+
+using test1_codec = wire_codec<field<1, &test1::a>>;
+using test2_codec = wire_codec<field<2, &test2::b>>;
+
+enum class state : std::uint8_t { idle, live = 3 };
+
+struct quote {
+    std::uint64_t id;
+    double bid;
+    float size;
+    bool firm;
+    state st;
+    std::int32_t delta;
+    char venue[6];
+};
+
+using quote_codec = wire_codec<field<1, &quote::id>, field<2, &quote::bid>, field<3, &quote::size>, field<4, &quote::firm>,
+                               field<5, &quote::st>, field<16, &quote::delta>, field<7, &quote::venue>>;
+
+struct fixed_only {
+    std::uint32_t n;
+    std::int64_t m;
+    double d;
+};
+
+using fixed_codec = wire_codec<field<1, &fixed_only::n>, field<2000, &fixed_only::m>, field<3, &fixed_only::d>>;
+
+static_assert(test1_codec::encoded_size(test1{ 150 }) == 3);
+static_assert(test1_codec::encoded_size(test1{ 0 }) == 0); // Zero is left out
+static_assert(test1_codec::encoded_size(test1{ -1 }) == 11); // Negative values are sign-extended
+static_assert(test2_codec::encoded_size(test2{ "testing" }) == 9);
+static_assert(test2_codec::max_size == 0 && quote_codec::max_size == 0);
+static_assert(fixed_codec::max_size == (1 + 5) + (2 + 10) + (1 + 8)); // Field 2000 takes a two-byte tag
+
+template <typename... Bytes>
+static std::vector<std::byte> bytes(const Bytes... b) {
+    return { static_cast<std::byte>(b)... };
+}
+
+template <typename Codec, typename T>
+static std::vector<std::byte> encode(const T& msg) {
+    std::vector<std::byte> out(Codec::encoded_size(msg));
+    assert(Codec::encode(out.data(), out.data() + out.size(), msg) == out.data() + out.size());
+    return out;
+}
+
+int main() {
+    assert(encode<test1_codec>(test1{ 150 }) == bytes(0x08, 0x96, 0x01));
+    assert(encode<test2_codec>(test2{ "testing" }) == bytes(0x12, 0x07, 't', 'e', 's', 't', 'i', 'n', 'g'));
+    assert(encode<test1_codec>(test1{ -2 }) == bytes(0x08, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01));
+
+    // Fixed-width values are little-endian on any host
+    {
+        const auto out = encode<quote_codec>(quote{ 0, 1.0, 0, false, state::idle, 0, "" });
+        assert(out == bytes(0x11, 0, 0, 0, 0, 0, 0, 0xF0, 0x3F));
+    }
+
+    // Round trips, including a field number with a two-byte tag and a member of every kind
+    {
+        const quote q{ 1ull << 63, -2.5, 0.75f, true, state::live, std::numeric_limits<std::int32_t>::min(), "XNAS" };
+        const auto out = encode<quote_codec>(q);
+        quote back{};
+        assert(quote_codec::decode(out.data(), out.data() + out.size(), back) == std::errc{});
+        assert(back.id == q.id && back.bid == q.bid && back.size == q.size && back.firm && back.st == state::live && back.delta == q.delta);
+        assert(std::strcmp(back.venue, "XNAS") == 0);
+    }
+    {
+        const fixed_only f{ std::numeric_limits<std::uint32_t>::max(), -1, 3.5 };
+        std::byte buf[fixed_codec::max_size];
+        const auto end = fixed_codec::encode(buf, buf + sizeof buf, f);
+        assert(static_cast<std::size_t>(end - buf) == fixed_codec::max_size);
+        fixed_only back{};
+        assert(fixed_codec::decode(buf, end, back) == std::errc{} && back.n == f.n && back.m == -1 && back.d == 3.5);
+    }
+
+    // Buffers that are too small are refused, without writing past them
+    {
+        const auto msg = test2{ "testing" };
+        std::byte buf[9];
+        for (std::size_t n = 0; n < sizeof buf; n++)
+            assert(test2_codec::encode(buf, buf + n, msg) == nullptr);
+        assert(test2_codec::encode(buf, buf + sizeof buf, msg) == buf + sizeof buf);
+    }
+
+    // Fields out of order, repeated fields (the last one wins), unknown fields of every wire type, and absent fields left untouched
+    {
+        const auto in = bytes(0x80, 0x01, 0x05,                 // 16: -> delta = 5
+                              0x48, 0xAC, 0x02,                 // 9: varint, unknown
+                              0x51, 1, 2, 3, 4, 5, 6, 7, 8,     // 10: fixed64, unknown
+                              0x5A, 0x02, 'h', 'i',             // 11: length-delimited, unknown
+                              0x65, 1, 2, 3, 4,                 // 12: fixed32, unknown
+                              0x08, 0x07, 0x08, 0x09,           // 1: id = 7, then id = 9
+                              0x3A, 0x03, 'L', 'S', 'E');       // 7: venue
+        quote q{};
+        q.bid = 4.25;
+        assert(quote_codec::decode(in.data(), in.data() + in.size(), q) == std::errc{});
+        assert(q.delta == 5 && q.id == 9 && q.bid == 4.25 && std::strcmp(q.venue, "LSE") == 0);
+    }
+
+    // Malformed input
+    const auto decode_ec = [](const std::vector<std::byte>& in) {
+        quote q{};
+        return quote_codec::decode(in.data(), in.data() + in.size(), q);
+    };
+    assert(decode_ec(bytes(0x08)) == std::errc::invalid_argument);                         // Missing value
+    assert(decode_ec(bytes(0x08, 0x80)) == std::errc::invalid_argument);                   // Truncated varint
+    assert(decode_ec(bytes(0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01)) == std::errc::invalid_argument); // Over 10 bytes
+    assert(decode_ec(bytes(0x11, 0, 0, 0)) == std::errc::invalid_argument);                // Truncated fixed64
+    assert(decode_ec(bytes(0x3A, 0x05, 'a')) == std::errc::invalid_argument);              // Length past the end
+    assert(decode_ec(bytes(0x0A, 0x00)) == std::errc::invalid_argument);                   // Known number, wrong wire type
+    assert(decode_ec(bytes(0x4B)) == std::errc::invalid_argument);                         // Groups aren't supported
+    assert(decode_ec(bytes(0x00, 0x00)) == std::errc::invalid_argument);                   // Field number 0
+    assert(decode_ec(bytes(0x3A, 0x06, 'a', 'b', 'c', 'd', 'e', 'f')) == std::errc::value_too_large); // Doesn't fit venue
+    assert(decode_ec({}) == std::errc{});
+}
@@ -0,0 +1,141 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.base_encoding;
+
+import uninttp.uni_auto;
+import <type_traits>;
+import <string_view>;
+import <cstddef>;
+import <cstdint>;
+import <array>;
+
+namespace uninttp::uninttp_internals {
+    /* Gives the value of a digit in base 2^`Bits` (hex, RFC 4648 base32, or base64 with either the standard or the URL-safe alphabet), or -1 */
+    template <unsigned Bits>
+    constexpr int base_digit(const char c) noexcept {
+        if constexpr (Bits == 4) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        } else if constexpr (Bits == 5) {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= '2' && c <= '7') return c - '2' + 26;
+        } else {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+' || c == '-') return 62;
+            if (c == '/' || c == '_') return 63;
+        }
+        return -1;
+    }
+
+    /* Decodes `s` into `out` (if any); gives the number of bytes. Whitespace is skipped, and padding is optional but must be complete if present */
+    template <unsigned Bits>
+    constexpr auto base_decode(const std::string_view s, std::byte* out) noexcept {
+        constexpr std::size_t block = Bits == 4 ? 2 : Bits == 5 ? 8 : 4;
+        std::uint32_t acc = 0;
+        unsigned pending = 0;
+        std::size_t n = 0, digits = 0, padding = 0;
+        for (const auto c : s) {
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                continue;
+            if (c == '=' && Bits != 4) {
+                padding++;
+                continue;
+            }
+            const auto v = base_digit<Bits>(c);
+            if (v < 0) {
+                compile_time_error("invalid digit");
+                continue;
+            }
+            if (padding > 0)
+                compile_time_error("digits after padding");
+            digits++;
+            acc = (acc << Bits) | static_cast<std::uint32_t>(v);
+            if ((pending += Bits) >= 8) {
+                pending -= 8;
+                if (out)
+                    out[n] = static_cast<std::byte>(acc >> pending);
+                n++;
+                acc &= (std::uint32_t{ 1 } << pending) - 1;
+            }
+        }
+        if (pending >= Bits)
+            compile_time_error("truncated input");
+        else if (acc != 0)
+            compile_time_error("non-zero trailing bits");
+        if (padding > 0 && (digits + padding) % block != 0)
+            compile_time_error("incorrect padding");
+        if (n == 0)
+            compile_time_error("nothing to decode");
+        return n;
+    }
+
+    template <unsigned Bits, std::size_t N>
+    constexpr auto base_decode(const std::string_view s) noexcept {
+        std::array<std::byte, N> out{};
+        base_decode<Bits>(s, out.data());
+        return out;
+    }
+
+    template <unsigned Bits, uni_auto Value>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Value>)::value_type, char>
+    constexpr auto base_decoded_v = to_uni_auto(base_decode<Bits, base_decode<Bits>(uni_auto_sv<Value>, nullptr)>(uni_auto_sv<Value>));
+}
+
+export namespace uninttp {
+    /**
+     * @brief Decodes a string of hexadecimal digits at compile time into a `uni_auto` object holding an array of `std::byte`s.
+     * @tparam Value The `uni_auto` string to decode (whitespace is ignored; anything else that isn't a hexadecimal digit fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto hex_v = uninttp_internals::base_decoded_v<4, Value>;
+
+    /**
+     * @brief Decodes a base32 (RFC 4648) string at compile time into a `uni_auto` object holding an array of `std::byte`s.
+     * @tparam Value The `uni_auto` string to decode (whitespace is ignored and padding is optional; invalid input fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto base32_v = uninttp_internals::base_decoded_v<5, Value>;
+
+    /**
+     * @brief Decodes a base64 string (using either the standard or the URL-safe alphabet) at compile time into a `uni_auto` object holding an array of `std::byte`s.
+     * @tparam Value The `uni_auto` string to decode (whitespace is ignored and padding is optional; invalid input fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto base64_v = uninttp_internals::base_decoded_v<6, Value>;
+}
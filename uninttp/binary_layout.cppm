@@ -0,0 +1,237 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.binary_layout;
+
+import uninttp.uni_auto;
+import uninttp.field;
+import <type_traits>;
+import <cstring>;
+import <cstddef>;
+import <cstdint>;
+import <utility>;
+import <array>;
+import <bit>;
+
+export namespace uninttp::uninttp_internals {
+    /* Never read from; only the addresses of its parts are compared, to find where the members of `C` lie */
+    template <typename C>
+    union bl_probe {
+        unsigned char bytes[sizeof(C)];
+        C object;
+
+        constexpr bl_probe() noexcept : bytes{} {}
+        constexpr ~bl_probe() {}
+    };
+
+    template <typename C>
+    constexpr bl_probe<C> bl_probe_v{};
+
+    template <typename C, typename T>
+    consteval std::size_t bl_offset_of(T C::* const member) noexcept {
+        for (std::size_t i = 0; i < sizeof(C); i++)
+            if (static_cast<const void*>(&bl_probe_v<C>.bytes[i]) == static_cast<const void*>(&(bl_probe_v<C>.object.*member)))
+                return i;
+        return sizeof(C);
+    }
+
+    template <typename T>
+    struct bl_scalar final {
+        using type = T;
+        static constexpr std::size_t count = 1;
+    };
+
+    template <typename T, std::size_t N>
+    struct bl_scalar<T[N]> final {
+        using type = typename bl_scalar<T>::type;
+        static constexpr std::size_t count = N * bl_scalar<T>::count;
+    };
+
+    template <typename T, std::size_t N>
+    struct bl_scalar<std::array<T, N>> final {
+        using type = typename bl_scalar<T>::type;
+        static constexpr std::size_t count = N * bl_scalar<T>::count;
+    };
+
+    template <std::size_t Size>
+    using bl_uint = std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>;
+
+    template <typename U>
+    constexpr U bl_byteswap(U v) noexcept {
+        if constexpr (sizeof(U) == 2)
+            return static_cast<U>(v << 8 | v >> 8);
+        else if constexpr (sizeof(U) == 4)
+            return (v << 24) | (v << 8 & 0xFF0000) | (v >> 8 & 0xFF00) | (v >> 24);
+        else {
+            v = (v & 0x00000000FFFFFFFF) << 32 | (v & 0xFFFFFFFF00000000) >> 32;
+            v = (v & 0x0000FFFF0000FFFF) << 16 | (v & 0xFFFF0000FFFF0000) >> 16;
+            return (v & 0x00FF00FF00FF00FF) << 8 | (v & 0xFF00FF00FF00FF00) >> 8;
+        }
+    }
+
+    /* Reverses the byte order of each of the `Count` scalars of type `T` at `p` */
+    template <typename T, std::size_t Count>
+    void bl_swap_in_place(std::byte* p) noexcept {
+        if constexpr (sizeof(T) > 1)
+            for (std::size_t i = 0; i < Count; i++, p += sizeof(T)) {
+                bl_uint<sizeof(T)> v;
+                std::memcpy(&v, p, sizeof(T));
+                v = bl_byteswap(v);
+                std::memcpy(p, &v, sizeof(T));
+            }
+    }
+
+    /* A stretch of bytes that gets copied in one go */
+    struct bl_run final {
+        std::size_t offset = 0;   // Within the object
+        std::size_t position = 0; // Within the serialized form
+        std::size_t size = 0;
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief Serializes data members into a packed binary form, one after another in the given order.
+     *
+     * Member offsets are worked out at compile time, so runs of members that lie next to each other in the class are copied with a single
+     * `std::memcpy()` of a fixed size. When the requested byte order isn't the native one, every scalar gets its bytes reversed in place
+     * as it gets copied; nothing depends on the values being copied.
+     * Members must be arithmetic types or enumerations that are 1, 2, 4 or 8 bytes wide, or (possibly nested) arrays of those; their class
+     * must be trivially copyable.
+     *
+     * @tparam Members The `uni_auto` pointers to the data members
+     */
+    template <uni_auto... Members>
+        requires (sizeof...(Members) > 0 && (std::is_member_object_pointer_v<uni_auto_simplify_t<Members>> && ...))
+    struct binary_layout final {
+    private:
+        using class_type = fields_class_t<field<0, Members>...>;
+
+        static_assert(std::is_trivially_copyable_v<class_type>, "binary_layout: the class must be trivially copyable");
+
+        template <uni_auto Member>
+        using member_t = typename field<0, Member>::value_type;
+
+        template <uni_auto Member>
+        using scalar_t = typename uninttp_internals::bl_scalar<member_t<Member>>::type;
+
+        static_assert(((std::is_arithmetic_v<scalar_t<Members>> || std::is_enum_v<scalar_t<Members>>) && ...), "binary_layout: members must be arithmetic types, enumerations or arrays of those");
+        static_assert(((sizeof(scalar_t<Members>) == 1 || sizeof(scalar_t<Members>) == 2 || sizeof(scalar_t<Members>) == 4 || sizeof(scalar_t<Members>) == 8) && ...), "binary_layout: scalars must be 1, 2, 4 or 8 bytes wide (e.g., no `long double`)");
+        static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big, "binary_layout: mixed-endian platforms are not supported");
+
+        static constexpr std::array<std::size_t, sizeof...(Members)> offsets { uninttp_internals::bl_offset_of(uni_auto_simplify_v<Members>)... };
+        static constexpr std::array<std::size_t, sizeof...(Members)> sizes { sizeof(member_t<Members>)... };
+
+        static constexpr auto run_count = [] {
+            std::size_t n = 1;
+            for (std::size_t i = 1; i < offsets.size(); i++)
+                n += offsets[i] != offsets[i - 1] + sizes[i - 1];
+            return n;
+        }();
+
+        static constexpr auto runs = [] {
+            std::array<uninttp_internals::bl_run, run_count> out{};
+            std::size_t n = 0, position = 0;
+            for (std::size_t i = 0; i < offsets.size(); position += sizes[i++])
+                if (i > 0 && offsets[i] == offsets[i - 1] + sizes[i - 1])
+                    out[n - 1].size += sizes[i];
+                else
+                    out[n++] = { offsets[i], position, sizes[i] };
+            return out;
+        }();
+
+        static constexpr auto positions = [] {
+            std::array<std::size_t, sizeof...(Members)> out{};
+            for (std::size_t i = 1; i < out.size(); i++)
+                out[i] = out[i - 1] + sizes[i - 1];
+            return out;
+        }();
+
+        template <uni_auto Member>
+        static auto swap(std::byte* const p) noexcept {
+            uninttp_internals::bl_swap_in_place<scalar_t<Member>, uninttp_internals::bl_scalar<member_t<Member>>::count>(p);
+        }
+
+    public:
+        /**
+         * @brief The number of bytes that an object gets serialized into.
+         */
+        static constexpr std::size_t size = (0 + ... + sizeof(member_t<Members>));
+
+        /**
+         * @brief Returns the number of `std::memcpy()` calls that a copy takes, i.e., the number of runs of adjacent members.
+         */
+        static constexpr auto copy_count() noexcept {
+            return run_count;
+        }
+
+        /**
+         * @brief Serializes `obj` into the `size` bytes at `out`.
+         * @tparam Order The byte order of the serialized form
+         * @return The end of the serialized form
+         */
+        template <std::endian Order = std::endian::little>
+        static std::byte* write(std::byte* const out, const class_type& obj) noexcept {
+            const auto in = reinterpret_cast<const std::byte*>(&obj);
+            [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                (std::memcpy(out + runs[Indices].position, in + runs[Indices].offset, runs[Indices].size), ...);
+            }(std::make_index_sequence<run_count>());
+            if constexpr (Order != std::endian::native)
+                [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                    (swap<Members>(out + positions[Indices]), ...);
+                }(std::index_sequence_for<decltype(Members)...>());
+            return out + size;
+        }
+
+        /**
+         * @brief Deserializes the `size` bytes at `in` into `obj`.
+         * @tparam Order The byte order of the serialized form
+         * @return The end of the serialized form
+         */
+        template <std::endian Order = std::endian::little>
+        static const std::byte* read(const std::byte* const in, class_type& obj) noexcept {
+            const auto out = reinterpret_cast<std::byte*>(&obj);
+            if constexpr (Order == std::endian::native)
+                [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                    (std::memcpy(out + runs[Indices].offset, in + runs[Indices].position, runs[Indices].size), ...);
+                }(std::make_index_sequence<run_count>());
+            else
+                [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                    ((std::memcpy(out + offsets[Indices], in + positions[Indices], sizes[Indices]), swap<Members>(out + offsets[Indices])), ...);
+                }(std::index_sequence_for<decltype(Members)...>());
+            return in + size;
+        }
+    };
+}
@@ -0,0 +1,342 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_CONFIG_HPP
+#define UNINTTP_CONFIG_HPP
+
+#include "uni_auto.hpp"
+#include "field.hpp"
+#include "escape.hpp"
+#include <type_traits>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        template <typename T>
+        struct cfg_is_std_array final : std::false_type {};
+
+        template <typename T, std::size_t N>
+        struct cfg_is_std_array<std::array<T, N>> final : std::true_type {};
+
+        /* A compile-time JSON parser that reads straight into the members described by `Fields` */
+        template <typename... Fields>
+        struct cfg_parser final {
+            using class_type = fields_class_t<Fields...>;
+
+            std::string_view s;
+            std::size_t i = 0;
+
+            constexpr auto ws() noexcept {
+                while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r'))
+                    i++;
+            }
+
+            constexpr bool eat(const char c) noexcept {
+                ws();
+                if (i < s.size() && s[i] == c) {
+                    i++;
+                    return true;
+                }
+                return false;
+            }
+
+            constexpr auto expect(const char c) noexcept {
+                if (!eat(c))
+                    compile_time_error("malformed JSON");
+            }
+
+            constexpr auto literal(const std::string_view word) noexcept {
+                ws();
+                if (s.substr(i, word.size()) != word)
+                    return false;
+                i += word.size();
+                return true;
+            }
+
+            /* Unescapes the string at the current position into `out` (if any); gives its length in bytes */
+            constexpr std::size_t string(char* out, const std::size_t capacity) noexcept {
+                expect('"');
+                std::size_t n = 0;
+                const auto put = [&](const char c) {
+                    if (out) {
+                        if (n >= capacity)
+                            compile_time_error("string does not fit into the member");
+                        else
+                            out[n] = c;
+                    }
+                    n++;
+                };
+                while (true) {
+                    if (i >= s.size()) {
+                        compile_time_error("unterminated string");
+                        return n;
+                    }
+                    const auto c = s[i++];
+                    if (c == '"')
+                        return n;
+                    if (c != '\\') {
+                        put(c);
+                        continue;
+                    }
+                    if (i >= s.size()) {
+                        compile_time_error("unterminated string");
+                        return n;
+                    }
+                    switch (const auto e = s[i++]) {
+                        case '"': case '\\': case '/': put(e); break;
+                        case 'b': put('\b'); break;
+                        case 'f': put('\f'); break;
+                        case 'n': put('\n'); break;
+                        case 'r': put('\r'); break;
+                        case 't': put('\t'); break;
+                        case 'u': {
+                            char utf8[4]{};
+                            const auto k = esc_unescape_u(s, i, utf8);
+                            if (k == 0)
+                                compile_time_error("malformed \\u escape, or a surrogate without its pair");
+                            for (std::size_t j = 0; j < k; j++)
+                                put(utf8[j]);
+                            break;
+                        }
+                        default:
+                            compile_time_error("malformed escape sequence");
+                    }
+                }
+            }
+
+            constexpr auto key() noexcept {
+                ws();
+                const auto begin = i + 1;
+                string(nullptr, 0);
+                return s.substr(begin, i - begin - 1);
+            }
+
+            template <typename T>
+            constexpr auto integer(T& out) noexcept {
+                ws();
+                const auto negative = i < s.size() && s[i] == '-';
+                if (negative)
+                    i++;
+                if (i >= s.size() || s[i] < '0' || s[i] > '9') {
+                    compile_time_error("expected a number");
+                    return;
+                }
+                std::uint64_t magnitude = 0;
+                for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++) {
+                    if (magnitude > (std::numeric_limits<std::uint64_t>::max() - static_cast<std::uint64_t>(s[i] - '0')) / 10)
+                        compile_time_error("integer is out of range");
+                    magnitude = magnitude * 10 + static_cast<std::uint64_t>(s[i] - '0');
+                }
+                if (i < s.size() && (s[i] == '.' || s[i] == 'e' || s[i] == 'E'))
+                    compile_time_error("expected an integer");
+                using limits = std::numeric_limits<T>;
+                if (negative) {
+                    if (!limits::is_signed || magnitude > static_cast<std::uint64_t>(-(limits::min() + 1)) + 1)
+                        compile_time_error("integer is out of range");
+                    out = static_cast<T>(-static_cast<std::int64_t>(magnitude - 1) - 1);
+                } else {
+                    if (magnitude > static_cast<std::uint64_t>(limits::max()))
+                        compile_time_error("integer is out of range");
+                    out = static_cast<T>(magnitude);
+                }
+            }
+
+            /* Correctly rounded whenever both the significand and the power of ten are exact as `double`s (up to 15 digits and 1e22); within a few ULPs otherwise */
+            template <typename T>
+            constexpr auto floating(T& out) noexcept {
+                ws();
+                const auto negative = i < s.size() && s[i] == '-';
+                if (negative)
+                    i++;
+                std::uint64_t significand = 0;
+                int digits = 0, exponent = 0;
+                auto any = false;
+                for (auto fraction = false; i < s.size(); i++) {
+                    if (s[i] == '.' && !fraction) {
+                        fraction = true;
+                        continue;
+                    }
+                    if (s[i] < '0' || s[i] > '9')
+                        break;
+                    any = true;
+                    if (digits < 19) {
+                        significand = significand * 10 + static_cast<std::uint64_t>(s[i] - '0');
+                        digits += significand != 0;
+                        exponent -= fraction;
+                    } else
+                        exponent += !fraction;
+                }
+                if (!any) {
+                    compile_time_error("expected a number");
+                    return;
+                }
+                if (i < s.size() && (s[i] == 'e' || s[i] == 'E')) {
+                    i++;
+                    int e = 0;
+                    const auto minus = i < s.size() && s[i] == '-';
+                    if (i < s.size() && (s[i] == '-' || s[i] == '+'))
+                        i++;
+                    if (i >= s.size() || s[i] < '0' || s[i] > '9')
+                        compile_time_error("malformed exponent");
+                    for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++)
+                        e = e < 10000 ? e * 10 + (s[i] - '0') : e;
+                    exponent += minus ? -e : e;
+                }
+                const auto power_of_ten = [](int e) {
+                    constexpr double powers[] { 1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256 };
+                    auto p = 1.0;
+                    for (auto k = 0; e > 0 && k < 9; k++, e >>= 1)
+                        if (e & 1)
+                            p *= powers[k];
+                    return e > 0 ? std::numeric_limits<double>::infinity() : p;
+                };
+                auto value = static_cast<double>(significand);
+                if (value != 0) {
+                    if (exponent >= 0)
+                        value *= power_of_ten(exponent);
+                    else if (exponent >= -308)
+                        value /= power_of_ten(-exponent);
+                    else
+                        value = value / power_of_ten(308) / power_of_ten(-exponent - 308);
+                }
+                out = static_cast<T>(negative ? -value : value);
+            }
+
+            template <typename T, std::size_t N>
+            constexpr auto elements(T* out) noexcept {
+                expect('[');
+                if (eat(']'))
+                    return;
+                std::size_t n = 0;
+                do {
+                    if (n == N) {
+                        compile_time_error("too many array elements for the member");
+                        return;
+                    }
+                    value(out[n++]);
+                } while (eat(','));
+                expect(']');
+            }
+
+            template <typename T>
+            constexpr void value(T& out) noexcept {
+                using U = std::remove_cv_t<T>;
+                if constexpr (std::is_same_v<U, bool>) {
+                    if (literal("true"))
+                        out = true;
+                    else if (literal("false"))
+                        out = false;
+                    else
+                        compile_time_error("expected a boolean");
+                } else if constexpr (std::is_enum_v<U>) {
+                    std::underlying_type_t<U> v{};
+                    integer(v);
+                    out = static_cast<U>(v);
+                } else if constexpr (std::is_integral_v<U>)
+                    integer(out);
+                else if constexpr (std::is_floating_point_v<U>)
+                    floating(out);
+                else if constexpr (std::is_array_v<U>) {
+                    if constexpr (std::is_same_v<std::remove_extent_t<U>, char>) {
+                        ws();
+                        out[string(out, std::extent_v<U> - 1)] = '\0';
+                    } else
+                        elements<std::remove_extent_t<U>, std::extent_v<U>>(out);
+                } else if constexpr (cfg_is_std_array<U>::value) {
+                    if constexpr (std::is_same_v<typename U::value_type, char>) {
+                        ws();
+                        out[string(out.data(), out.size() - 1)] = '\0';
+                    } else
+                        elements<typename U::value_type, std::tuple_size_v<U>>(out.data());
+                } else
+                    static_assert(!sizeof(U), "config_v: unsupported member type");
+            }
+
+            template <typename Field>
+            constexpr auto member(const std::string_view k, class_type& out, std::array<bool, sizeof...(Fields)>& seen, const std::size_t index) noexcept {
+                if (k != uni_auto_sv<Field::key>)
+                    return false;
+                if (seen[index])
+                    compile_time_error("duplicate key");
+                seen[index] = true;
+                value(Field::get(out));
+                return true;
+            }
+
+            constexpr auto parse() noexcept {
+                class_type out{};
+                std::array<bool, sizeof...(Fields)> seen{};
+                expect('{');
+                if (!eat('}')) {
+                    do {
+                        const auto k = key();
+                        expect(':');
+                        const auto found = [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                            return (member<Fields>(k, out, seen, Indices) || ...);
+                        }(std::index_sequence_for<Fields...>());
+                        if (!found)
+                            compile_time_error("unknown key");
+                    } while (eat(','));
+                    expect('}');
+                }
+                ws();
+                if (i != s.size())
+                    compile_time_error("trailing characters after the JSON object");
+                return out;
+            }
+        };
+    }
+
+    /**
+     * @brief Parses a JSON object at compile time into the class that the fields belong to.
+     *
+     * Keys are matched against the fields' names; members whose key is absent keep their default member initializers. Malformed JSON,
+     * unknown or duplicate keys, values of the wrong type and values that don't fit into their members all fail to compile.
+     * Supported member types are `bool`, integers, enumerations (read as their underlying integer), floating-point numbers, `char`
+     * arrays (read as strings) and arrays of any of those (read as JSON arrays).
+     *
+     * @tparam Json The `uni_auto` string holding the JSON object
+     * @tparam Fields The `field`s describing the members to be read, keyed by their names
+     */
+    template <uni_auto Json, field_type... Fields>
+        requires (sizeof...(Fields) > 0 && std::is_same_v<typename decltype(uni_auto_sv<Json>)::value_type, char>)
+    constexpr auto config_v = uninttp_internals::cfg_parser<Fields...>{ uni_auto_sv<Json> }.parse();
+}
+
+#endif /* UNINTTP_CONFIG_HPP */
@@ -0,0 +1,321 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_CSV_PROJECTION_HPP
+#define UNINTTP_CSV_PROJECTION_HPP
+
+#include "uni_auto.hpp"
+#include <system_error>
+#include <type_traits>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <array>
+#include <tuple>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        /* Marks the bytes of `w` that are zero with their high bits */
+        constexpr std::uint64_t csv_zero_bytes(const std::uint64_t w) noexcept {
+            constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+            return ~(((w & low_bits) + low_bits) | w | low_bits);
+        }
+
+        /* Finds the first of `Chars` in `[p, last)`, eight bytes at a time */
+        template <char... Chars>
+        const char* csv_find(const char* p, const char* const last) noexcept {
+            constexpr std::uint64_t ones = 0x0101010101010101;
+            for (; last - p >= 8; p += 8) {
+                std::uint64_t w;
+                std::memcpy(&w, p, 8);
+                if (const auto hits = (csv_zero_bytes(w ^ (ones * static_cast<unsigned char>(Chars))) | ...); hits != 0)
+                    return p + (std::endian::native == std::endian::little ? std::countr_zero(hits) : std::countl_zero(hits)) / 8;
+            }
+            while (p != last && ((*p != Chars) && ...))
+                p++;
+            return p;
+        }
+
+        enum class csv_end { field, record, incomplete, malformed };
+
+        /*
+         * Reads the field at `p` and moves past it and the delimiter that ends it. Quoted fields come without their quotes, but any doubled
+         * quotes in them stay as they are. Unless `final` is set, the end of the input doesn't end a record.
+         */
+        inline csv_end csv_field(const char*& p, const char* const last, const bool final, std::string_view& text) noexcept {
+            if (p != last && *p == '"') {
+                const auto begin = ++p;
+                while (true) {
+                    p = static_cast<const char*>(std::memchr(p, '"', static_cast<std::size_t>(last - p)));
+                    if (p == nullptr)
+                        return final ? csv_end::malformed : csv_end::incomplete;
+                    if (p + 1 == last || p[1] != '"')
+                        break;
+                    p += 2;
+                }
+                text = { begin, static_cast<std::size_t>(p++ - begin) };
+                if (p == last)
+                    return final ? csv_end::record : csv_end::incomplete;
+                if (*p == ',') {
+                    p++;
+                    return csv_end::field;
+                }
+                if (*p == '\r' && p + 1 == last)
+                    return final ? (p++, csv_end::record) : csv_end::incomplete;
+                p += *p == '\r' && p[1] == '\n';
+                if (*p != '\n')
+                    return csv_end::malformed;
+                p++;
+                return csv_end::record;
+            }
+            const auto begin = p;
+            p = csv_find<',', '\n', '"'>(p, last);
+            if (p != last && *p == '"')
+                return csv_end::malformed;
+            text = { begin, static_cast<std::size_t>(p - begin) };
+            if (p == last)
+                return final ? csv_end::record : csv_end::incomplete;
+            if (*p++ == ',')
+                return csv_end::field;
+            if (!text.empty() && text.back() == '\r')
+                text.remove_suffix(1);
+            return csv_end::record;
+        }
+
+        /* Moves past the rest of the record at `p` without looking at its fields; gives `nullptr` if the record doesn't end in `[p, last)` */
+        inline const char* csv_skip_record(const char* p, const char* const last, const bool final) noexcept {
+            while (true) {
+                p = csv_find<'\n', '"'>(p, last);
+                if (p == last)
+                    return final ? p : nullptr;
+                if (*p++ == '\n')
+                    return p;
+                p = static_cast<const char*>(std::memchr(p, '"', static_cast<std::size_t>(last - p)));
+                if (p == nullptr)
+                    return nullptr;
+                p++;
+            }
+        }
+
+        template <typename T>
+        std::errc csv_convert(const std::string_view text, T& out) noexcept {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                out = text;
+                return {};
+            } else if constexpr (std::is_same_v<T, bool>) {
+                if (text == "1" || text == "true")
+                    out = true;
+                else if (text == "0" || text == "false")
+                    out = false;
+                else
+                    return std::errc::invalid_argument;
+                return {};
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+                if (ec == std::errc{} && end != text.data() + text.size())
+                    return std::errc::invalid_argument;
+                return ec;
+            } else
+                static_assert(!sizeof(T), "csv_projection: unsupported parameter type");
+        }
+
+        /* The (decayed) parameter types of a callable that isn't overloaded, as a `std::tuple` */
+        template <typename F>
+        struct csv_parameters final : csv_parameters<decltype(&F::operator())> {};
+
+        template <typename R, typename... Args>
+        struct csv_parameters<R(*)(Args...)> { using type = std::tuple<std::remove_cvref_t<Args>...>; };
+
+        template <typename R, typename... Args>
+        struct csv_parameters<R(*)(Args...) noexcept> : csv_parameters<R(*)(Args...)> {};
+
+        template <typename C, typename R, typename... Args>
+        struct csv_parameters<R(C::*)(Args...)> : csv_parameters<R(*)(Args...)> {};
+
+        template <typename C, typename R, typename... Args>
+        struct csv_parameters<R(C::*)(Args...) const> : csv_parameters<R(*)(Args...)> {};
+
+        template <typename C, typename R, typename... Args>
+        struct csv_parameters<R(C::*)(Args...) noexcept> : csv_parameters<R(*)(Args...)> {};
+
+        template <typename C, typename R, typename... Args>
+        struct csv_parameters<R(C::*)(Args...) const noexcept> : csv_parameters<R(*)(Args...)> {};
+    }
+
+    /**
+     * @brief Reads only the named columns out of CSV (RFC 4180) records.
+     *
+     * The column names are resolved against the header once. After that, each record is split only up to its last projected column,
+     * and the rest of it is skipped by scanning for the line break, eight bytes at a time. Input can come in chunks of any size: a record
+     * that doesn't end within a chunk is left unconsumed, to be passed again at the front of the next chunk.
+     *
+     * @tparam Columns The `uni_auto` strings naming the columns to read, in the order their values are handed out
+     */
+    template <uni_auto... Columns>
+        requires (sizeof...(Columns) > 0 && (std::is_same_v<typename decltype(uni_auto_sv<Columns>)::value_type, char> && ...))
+    struct csv_projection final {
+    private:
+        static constexpr std::array<std::string_view, sizeof...(Columns)> names { uni_auto_sv<Columns>... };
+
+        /* Where each column is within a record, and the order to visit them in */
+        std::array<std::size_t, sizeof...(Columns)> columns{};
+        std::array<std::size_t, sizeof...(Columns)> order{};
+
+        template <typename F, std::size_t... Indices>
+        static auto call(F& f, const std::array<std::string_view, sizeof...(Columns)>& values, std::errc& ec, std::index_sequence<Indices...>) {
+            if constexpr (std::is_invocable_v<F&, decltype((void) Indices, std::string_view{})...>)
+                return std::invoke(f, values[Indices]...);
+            else {
+                using parameters = typename uninttp_internals::csv_parameters<std::decay_t<F>>::type;
+                static_assert(std::tuple_size_v<parameters> == sizeof...(Columns), "csv_projection: the callback must take one parameter per column");
+                parameters args;
+                if (((ec = uninttp_internals::csv_convert(values[Indices], std::get<Indices>(args)), ec == std::errc{}) && ...))
+                    return std::apply(f, std::move(args));
+                using result = std::invoke_result_t<F&, std::tuple_element_t<Indices, parameters>...>;
+                if constexpr (!std::is_void_v<result>)
+                    return result{};
+            }
+        }
+
+    public:
+        /**
+         * @brief Returns the number of projected columns.
+         */
+        static constexpr auto size() noexcept {
+            return sizeof...(Columns);
+        }
+
+        /**
+         * @brief Returns the position within a record of the `i`th projected column, as resolved by `header()`.
+         */
+        constexpr auto column(const std::size_t i) const noexcept {
+            return columns[i];
+        }
+
+        /**
+         * @brief Resolves the column names against the header record at the front of `chunk`.
+         * @return The end of the header and `std::errc{}` once it has been read, the start of `chunk` and `std::errc{}` if it doesn't end
+         * within `chunk` yet (unless `final` is set), or `std::errc::invalid_argument` if it is malformed or lacks one of the columns
+         */
+        std::from_chars_result header(const std::string_view chunk, const bool final = false) noexcept {
+            const auto first = chunk.data(), last = first + chunk.size();
+            auto p = first;
+            std::array<bool, sizeof...(Columns)> found{};
+            for (std::size_t field = 0;; field++) {
+                std::string_view text;
+                const auto end = uninttp_internals::csv_field(p, last, final, text);
+                if (end == uninttp_internals::csv_end::incomplete)
+                    return { first, std::errc{} };
+                if (end == uninttp_internals::csv_end::malformed)
+                    return { p, std::errc::invalid_argument };
+                for (std::size_t i = 0; i < names.size(); i++)
+                    if (!found[i] && names[i] == text) {
+                        found[i] = true;
+                        columns[i] = field;
+                    }
+                if (end == uninttp_internals::csv_end::record)
+                    break;
+            }
+            if (std::find(found.begin(), found.end(), false) != found.end())
+                return { first, std::errc::invalid_argument };
+            for (std::size_t i = 0; i < order.size(); i++)
+                order[i] = i;
+            std::sort(order.begin(), order.end(), [&](const auto a, const auto b) { return columns[a] < columns[b]; });
+            return { p, std::errc{} };
+        }
+
+        /**
+         * @brief Reads the records in `chunk` (which must come after the header), handing the projected columns of each one to `f`.
+         *
+         * If `f` can be called with a `std::string_view` per column, it gets their raw text (without the quotes, but with any doubled
+         * quotes left in). Otherwise, the text is converted to the types of its parameters: `std::string_view`, `bool` (`0`, `1`, `false`
+         * or `true`) and any arithmetic type that `std::from_chars()` takes. Reading stops early if `f` returns `false`. Empty lines are
+         * skipped. Unless `final` is set, a record that doesn't end within `chunk` is left unread.
+         *
+         * @return The end of the records that were read and `std::errc{}`; otherwise the start of the offending record and
+         * `std::errc::invalid_argument` if it's malformed, lacks a column or holds an unconvertible value, or `std::errc::result_out_of_range`
+         */
+        template <typename F>
+        std::from_chars_result feed(const std::string_view chunk, F&& f, const bool final = false) {
+            const auto last = chunk.data() + chunk.size();
+            auto p = chunk.data();
+            while (p != last) {
+                if (*p == '\n' || (*p == '\r' && p + 1 != last && p[1] == '\n')) {
+                    p += *p == '\r' ? 2 : 1;
+                    continue;
+                }
+                const auto start = p;
+                std::array<std::string_view, sizeof...(Columns)> values;
+                auto end = uninttp_internals::csv_end::field;
+                std::size_t k = 0;
+                for (std::size_t field = 0; k < order.size() && end == uninttp_internals::csv_end::field; field++) {
+                    std::string_view text;
+                    end = uninttp_internals::csv_field(p, last, final, text);
+                    if (end == uninttp_internals::csv_end::incomplete)
+                        return { start, std::errc{} };
+                    if (end == uninttp_internals::csv_end::malformed)
+                        return { start, std::errc::invalid_argument };
+                    for (; k < order.size() && columns[order[k]] == field; k++)
+                        values[order[k]] = text;
+                }
+                if (k < order.size())
+                    return { start, std::errc::invalid_argument };
+                if (end == uninttp_internals::csv_end::field && (p = uninttp_internals::csv_skip_record(p, last, final)) == nullptr)
+                    return { start, final ? std::errc::invalid_argument : std::errc{} };
+                std::errc ec{};
+                if constexpr (std::is_same_v<decltype(call(f, values, ec, std::index_sequence_for<decltype(Columns)...>())), bool>) {
+                    const auto more = call(f, values, ec, std::index_sequence_for<decltype(Columns)...>());
+                    if (ec != std::errc{})
+                        return { start, ec };
+                    if (!more)
+                        break;
+                } else {
+                    call(f, values, ec, std::index_sequence_for<decltype(Columns)...>());
+                    if (ec != std::errc{})
+                        return { start, ec };
+                }
+            }
+            return { p, std::errc{} };
+        }
+    };
+}
+
+#endif /* UNINTTP_CSV_PROJECTION_HPP */
@@ -0,0 +1,361 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_ENUM_ARRAY_HPP
+#define UNINTTP_ENUM_ARRAY_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <limits>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        enum class ea_kind { identity, offset, hash };
+
+        /* Maps the enumerators `Keys...` to the dense indices `0` to `sizeof...(Keys) - 1`, in ascending order of their values */
+        template <uni_auto... Keys>
+        struct ea_mapping final {
+            using key_type = std::common_type_t<uni_auto_simplify_t<Keys>...>;
+            using unsigned_type = std::make_unsigned_t<std::underlying_type_t<key_type>>;
+
+            static constexpr std::size_t size = sizeof...(Keys);
+
+            static constexpr auto keys = [] {
+                std::array<key_type, size> out { uni_auto_simplify_v<Keys>... };
+                std::sort(out.begin(), out.end());
+                if (std::adjacent_find(out.begin(), out.end()) != out.end())
+                    compile_time_error("an enumerator (or its value) appears more than once");
+                return out;
+            }();
+
+            static constexpr auto bits(const key_type k) noexcept {
+                return static_cast<unsigned_type>(k);
+            }
+
+            static constexpr auto kind = [] {
+                for (std::size_t i = 1; i < size; i++)
+                    if (bits(keys[i]) != static_cast<unsigned_type>(bits(keys[0]) + i))
+                        return ea_kind::hash;
+                return bits(keys[0]) == 0 ? ea_kind::identity : ea_kind::offset;
+            }();
+
+            /* A multiplier and a number of bits such that the top bits of each key times the multiplier pick a slot of its own */
+            static constexpr auto hash = [] {
+                struct out_t final {
+                    std::uint64_t multiplier = 0;
+                    int bits = 1;
+                } out;
+                if constexpr (kind == ea_kind::hash) {
+                    const auto min_bits = std::max(1, static_cast<int>(std::bit_width(size - 1)));
+                    const auto collision_free = [](const std::uint64_t multiplier, const int b) {
+                        std::array<bool, std::size_t{ 1 } << (std::max(1, static_cast<int>(std::bit_width(size - 1))) + 4)> used{};
+                        for (const auto k : keys) {
+                            const auto slot = static_cast<std::size_t>((static_cast<std::uint64_t>(bits(k)) * multiplier) >> (64 - b));
+                            if (used[slot])
+                                return false;
+                            used[slot] = true;
+                        }
+                        return true;
+                    };
+                    for (auto b = min_bits; b <= min_bits + 4; b++)
+                        for (std::uint64_t seed = 1; seed <= 1024; seed++)
+                            if (const auto multiplier = (seed * 0x9E3779B97F4A7C15u) | 1; collision_free(multiplier, b))
+                                return out_t { multiplier, b };
+                    compile_time_error("couldn't find a perfect hash for the enumerators");
+                }
+                return out;
+            }();
+
+            /* The dense index of the key hashing to each slot; unused slots hold 0, whose key tells them apart */
+            static constexpr auto slots = [] {
+                using slot_t = std::conditional_t<size <= 0x100, std::uint8_t, std::uint16_t>;
+                std::array<slot_t, kind == ea_kind::hash ? std::size_t{ 1 } << hash.bits : 0> out{};
+                for (std::size_t i = 0; i < out.size() && i < size; i++)
+                    out[static_cast<std::size_t>((static_cast<std::uint64_t>(bits(keys[i])) * hash.multiplier) >> (64 - hash.bits))] = static_cast<slot_t>(i);
+                return out;
+            }();
+
+            /* The dense index of `k`, which must be one of the keys */
+            static constexpr std::size_t index(const key_type k) noexcept {
+                if constexpr (kind == ea_kind::identity)
+                    return static_cast<std::size_t>(bits(k));
+                else if constexpr (kind == ea_kind::offset)
+                    return static_cast<std::size_t>(static_cast<unsigned_type>(bits(k) - bits(keys[0])));
+                else
+                    return slots[static_cast<std::size_t>((static_cast<std::uint64_t>(bits(k)) * hash.multiplier) >> (64 - hash.bits))];
+            }
+
+            static constexpr bool contains(const key_type k) noexcept {
+                if constexpr (kind == ea_kind::hash)
+                    return keys[index(k)] == k;
+                else
+                    return static_cast<unsigned_type>(bits(k) - bits(keys[0])) < size;
+            }
+        };
+
+        template <uni_auto... Keys>
+        concept ea_keys = sizeof...(Keys) > 0 && (std::is_enum_v<uni_auto_simplify_t<Keys>> && ...)
+                       && (std::is_same_v<uni_auto_simplify_t<Keys>, std::common_type_t<uni_auto_simplify_t<Keys>...>> && ...);
+    }
+
+    /**
+     * @brief A fixed-size array indexed by the enumerators `Keys...`, which need not have contiguous values.
+     *
+     * The elements are stored contiguously, in ascending order of their keys' values, and a key is turned into an index at compile time
+     * when it's known then, or otherwise through the cheapest mapping that the values allow: none if they run from 0 on, a subtraction if
+     * they run from elsewhere on, or else a multiplicative perfect hash followed by a load from a small table.
+     *
+     * @tparam T The type of the elements
+     * @tparam Keys The `uni_auto` enumerators
+     */
+    template <typename T, uni_auto... Keys>
+        requires uninttp_internals::ea_keys<Keys...>
+    struct enum_array final {
+    private:
+        using mapping = uninttp_internals::ea_mapping<Keys...>;
+
+    public:
+        using key_type = typename mapping::key_type;
+        using value_type = T;
+
+        /**
+         * @brief The keys, in the order of their elements.
+         */
+        static constexpr auto keys = mapping::keys;
+
+        /**
+         * @brief The elements.
+         */
+        std::array<T, sizeof...(Keys)> values{};
+
+        /**
+         * @brief Gives the number of elements.
+         */
+        static constexpr std::size_t size() noexcept {
+            return sizeof...(Keys);
+        }
+
+        /**
+         * @brief Checks whether `key` is one of the keys.
+         */
+        static constexpr bool contains(const key_type key) noexcept {
+            return mapping::contains(key);
+        }
+
+        /**
+         * @brief Gives the index of the element of `key`, which must be one of the keys.
+         */
+        static constexpr std::size_t index(const key_type key) noexcept {
+            return mapping::index(key);
+        }
+
+        /**
+         * @brief Gives the element of `key`, which must be one of the keys.
+         */
+        constexpr T& operator[](const key_type key) noexcept {
+            return values[index(key)];
+        }
+
+        /**
+         * @brief Gives the element of `key`, which must be one of the keys.
+         */
+        constexpr const T& operator[](const key_type key) const noexcept {
+            return values[index(key)];
+        }
+
+        /**
+         * @brief Gives the element of `Key`.
+         */
+        template <uni_auto Key>
+            requires (mapping::contains(uni_auto_simplify_v<Key>))
+        constexpr T& get() noexcept {
+            return std::get<mapping::index(uni_auto_simplify_v<Key>)>(values);
+        }
+
+        /**
+         * @brief Gives the element of `Key`.
+         */
+        template <uni_auto Key>
+            requires (mapping::contains(uni_auto_simplify_v<Key>))
+        constexpr const T& get() const noexcept {
+            return std::get<mapping::index(uni_auto_simplify_v<Key>)>(values);
+        }
+
+        constexpr auto begin() noexcept { return values.begin(); }
+        constexpr auto begin() const noexcept { return values.begin(); }
+        constexpr auto end() noexcept { return values.end(); }
+        constexpr auto end() const noexcept { return values.end(); }
+
+        friend constexpr bool operator==(const enum_array&, const enum_array&) = default;
+    };
+
+    /**
+     * @brief A fixed-size set of the enumerators `Keys...`, as one bit each, mapped to bits the same way as `enum_array` maps them to elements.
+     * @tparam Keys The `uni_auto` enumerators
+     */
+    template <uni_auto... Keys>
+        requires uninttp_internals::ea_keys<Keys...>
+    struct enum_bitset final {
+    private:
+        using mapping = uninttp_internals::ea_mapping<Keys...>;
+
+        static constexpr std::size_t word_count = (sizeof...(Keys) + 63) / 64;
+
+        static constexpr auto last_word_mask = sizeof...(Keys) % 64 == 0 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << (sizeof...(Keys) % 64)) - 1;
+
+    public:
+        using key_type = typename mapping::key_type;
+
+        /**
+         * @brief The keys, in the order of their bits.
+         */
+        static constexpr auto keys = mapping::keys;
+
+        /**
+         * @brief The bits, 64 to a word, starting from the least significant bit of the first word; bits past the last key stay clear.
+         */
+        std::array<std::uint64_t, word_count> words{};
+
+        /**
+         * @brief Gives the number of keys.
+         */
+        static constexpr std::size_t size() noexcept {
+            return sizeof...(Keys);
+        }
+
+        /**
+         * @brief Checks whether `key` is one of the keys.
+         */
+        static constexpr bool contains(const key_type key) noexcept {
+            return mapping::contains(key);
+        }
+
+        /**
+         * @brief Checks whether the bit of `key`, which must be one of the keys, is set.
+         */
+        constexpr bool test(const key_type key) const noexcept {
+            const auto i = mapping::index(key);
+            return (words[i / 64] >> (i % 64)) & 1;
+        }
+
+        /**
+         * @brief Sets the bit of `key`, which must be one of the keys, to `value`.
+         */
+        constexpr enum_bitset& set(const key_type key, const bool value = true) noexcept {
+            const auto i = mapping::index(key);
+            words[i / 64] = (words[i / 64] & ~(std::uint64_t{ 1 } << (i % 64))) | (static_cast<std::uint64_t>(value) << (i % 64));
+            return *this;
+        }
+
+        /**
+         * @brief Clears the bit of `key`, which must be one of the keys.
+         */
+        constexpr enum_bitset& reset(const key_type key) noexcept {
+            return set(key, false);
+        }
+
+        /**
+         * @brief Gives the number of keys whose bits are set.
+         */
+        constexpr std::size_t count() const noexcept {
+            std::size_t n = 0;
+            for (const auto w : words)
+                n += static_cast<std::size_t>(std::popcount(w));
+            return n;
+        }
+
+        constexpr bool any() const noexcept {
+            return count() != 0;
+        }
+
+        constexpr bool none() const noexcept {
+            return count() == 0;
+        }
+
+        constexpr bool all() const noexcept {
+            return count() == size();
+        }
+
+        /**
+         * @brief Calls `f(key)` on each key whose bit is set, in the order of the keys.
+         */
+        template <typename F>
+        constexpr void for_each(F&& f) const {
+            for (std::size_t w = 0; w < word_count; w++)
+                for (auto bits = words[w]; bits != 0; bits &= bits - 1)
+                    f(keys[w * 64 + static_cast<std::size_t>(std::countr_zero(bits))]);
+        }
+
+        constexpr enum_bitset& operator&=(const enum_bitset& other) noexcept {
+            for (std::size_t w = 0; w < word_count; w++)
+                words[w] &= other.words[w];
+            return *this;
+        }
+
+        constexpr enum_bitset& operator|=(const enum_bitset& other) noexcept {
+            for (std::size_t w = 0; w < word_count; w++)
+                words[w] |= other.words[w];
+            return *this;
+        }
+
+        constexpr enum_bitset& operator^=(const enum_bitset& other) noexcept {
+            for (std::size_t w = 0; w < word_count; w++)
+                words[w] ^= other.words[w];
+            return *this;
+        }
+
+        constexpr enum_bitset operator~() const noexcept {
+            enum_bitset out;
+            for (std::size_t w = 0; w < word_count; w++)
+                out.words[w] = ~words[w];
+            out.words.back() &= last_word_mask;
+            return out;
+        }
+
+        friend constexpr enum_bitset operator&(enum_bitset a, const enum_bitset& b) noexcept { return a &= b; }
+        friend constexpr enum_bitset operator|(enum_bitset a, const enum_bitset& b) noexcept { return a |= b; }
+        friend constexpr enum_bitset operator^(enum_bitset a, const enum_bitset& b) noexcept { return a ^= b; }
+
+        friend constexpr bool operator==(const enum_bitset&, const enum_bitset&) = default;
+    };
+}
+
+#endif /* UNINTTP_ENUM_ARRAY_HPP */
@@ -0,0 +1,214 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_ENUM_NAME_HPP
+#define UNINTTP_ENUM_NAME_HPP
+
+#include "uni_auto.hpp"
+#include "json_reader.hpp"
+#include <type_traits>
+#include <string_view>
+#include <algorithm>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <limits>
+#include <array>
+
+namespace uninttp {
+    /**
+     * @brief The range of values that `enum_names`, `enum_name()` and `enum_cast()` look for enumerators of `E` in.
+     *
+     * It's clamped to what the underlying type of `E` can hold; specialize it for enumerations with values outside of it.
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    struct enum_range final {
+        static constexpr std::intmax_t min = -128;
+        static constexpr std::intmax_t max = 127;
+    };
+
+    namespace uninttp_internals {
+        /* The compiler's signature of this function, which spells out `Value` (as an enumerator's name if it's one) */
+        template <auto Value>
+        constexpr auto en_signature() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return std::string_view { __FUNCSIG__ };
+#else
+            return std::string_view { __PRETTY_FUNCTION__ };
+#endif
+        }
+
+        /* Extracts the unqualified name of the enumerator `Value` from `en_signature()`; empty if `Value` has no name */
+        template <auto Value>
+        constexpr std::string_view en_name() noexcept {
+            constexpr auto signature = en_signature<Value>();
+#if defined(_MSC_VER) && !defined(__clang__)
+            constexpr auto first = signature.find("en_signature<") + 13;
+            constexpr auto last = signature.rfind(">(");
+#else
+            constexpr auto first = signature.find("Value = ") + 8;
+            constexpr auto last = std::min(signature.find(';', first), signature.rfind(']'));
+#endif
+            constexpr auto spelled = signature.substr(first, last - first);
+            constexpr auto name = spelled.substr(spelled.rfind(':') + 1);
+            if constexpr (!spelled.starts_with('(') && !name.empty() && (name.front() == '_' || ((name.front() | 0x20) >= 'a' && (name.front() | 0x20) <= 'z')))
+                return name;
+            else
+                return {};
+        }
+
+        /* The name of `Value`, copied into storage of its own (null-terminated) */
+        template <auto Value>
+        inline constexpr auto en_name_storage = [] {
+            std::array<char, en_name<Value>().size() + 1> out{};
+            std::copy(en_name<Value>().begin(), en_name<Value>().end(), out.begin());
+            return out;
+        }();
+
+        template <typename E>
+        struct en_reflected final {
+            using underlying_type = std::underlying_type_t<E>;
+
+            static constexpr auto min = std::cmp_less(enum_range<E>::min, std::numeric_limits<underlying_type>::min()) ? static_cast<std::intmax_t>(std::numeric_limits<underlying_type>::min()) : enum_range<E>::min;
+            static constexpr auto max = std::cmp_greater(enum_range<E>::max, std::numeric_limits<underlying_type>::max()) ? static_cast<std::intmax_t>(std::numeric_limits<underlying_type>::max()) : enum_range<E>::max;
+
+            static_assert(min <= max, "enum_range: the range is empty");
+
+            static constexpr auto named = []<std::size_t... I>(std::index_sequence<I...>) {
+                return std::array<bool, sizeof...(I)> { !en_name<static_cast<E>(min + static_cast<std::intmax_t>(I))>().empty()... };
+            }(std::make_index_sequence<static_cast<std::size_t>(max - min + 1)>{});
+
+            static constexpr auto count = static_cast<std::size_t>(std::count(named.begin(), named.end(), true));
+
+            /* The enumerators, in ascending order of their values */
+            static constexpr auto values = [] {
+                std::array<E, count> out{};
+                for (std::size_t i = 0, n = 0; i < named.size(); i++)
+                    if (named[i])
+                        out[n++] = static_cast<E>(min + static_cast<std::intmax_t>(i));
+                return out;
+            }();
+
+            static constexpr auto names = []<std::size_t... I>(std::index_sequence<I...>) {
+                return std::array<std::string_view, count> { std::string_view { en_name_storage<values[I]>.data(), en_name_storage<values[I]>.size() - 1 }... };
+            }(std::make_index_sequence<count>{});
+
+            static constexpr auto first = count == 0 ? 0 : static_cast<std::intmax_t>(values.front());
+
+            using slot_t = std::conditional_t<count < 0xFF, std::uint8_t, std::uint16_t>;
+
+            /* The index of each value in `values`, from the first enumerator's value to the last one's */
+            static constexpr auto indices = [] {
+                std::array<slot_t, count == 0 ? 0 : static_cast<std::size_t>(static_cast<std::intmax_t>(values.back()) - first + 1)> out{};
+                out.fill(std::numeric_limits<slot_t>::max());
+                for (std::size_t i = 0; i < count; i++)
+                    out[static_cast<std::size_t>(static_cast<std::intmax_t>(values[i]) - first)] = static_cast<slot_t>(i);
+                return out;
+            }();
+
+            static constexpr auto hash = count == 0 ? jr_hash { 0, 0, 0, 1 } : jr_perfect_hash(names);
+
+            static constexpr auto slots = [] {
+                std::array<slot_t, std::size_t{ 1 } << hash.bits> out{};
+                out.fill(std::numeric_limits<slot_t>::max());
+                for (std::size_t i = 0; i < count; i++)
+                    out[hash(names[i])] = static_cast<slot_t>(i);
+                return out;
+            }();
+        };
+    }
+
+    /**
+     * @brief Gives the (unqualified) name of the enumerator held by `Value` as a null-terminated `std::string_view`, or an empty one if
+     * the value has no name.
+     *
+     * The name is taken from the compiler's spelling of a function signature at compile time; only the name itself ends up in the program.
+     */
+    template <uni_auto Value>
+        requires std::is_enum_v<uni_auto_simplify_t<Value>>
+    inline constexpr auto enum_name_v = std::string_view {
+        uninttp_internals::en_name_storage<uni_auto_simplify_v<Value>>.data(),
+        uninttp_internals::en_name_storage<uni_auto_simplify_v<Value>>.size() - 1
+    };
+
+    /**
+     * @brief The enumerators of `E` within `enum_range<E>`, in ascending order of their values (enumerators that share a value count once).
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    inline constexpr auto enum_values = uninttp_internals::en_reflected<E>::values;
+
+    /**
+     * @brief The names of `enum_values<E>`, in the same order (as null-terminated `std::string_view`s).
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    inline constexpr auto enum_names = uninttp_internals::en_reflected<E>::names;
+
+    /**
+     * @brief Gives the name of `value` through a table indexed by value, or an empty `std::string_view` if it isn't one of `enum_values<E>`.
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    constexpr std::string_view enum_name(const E value) noexcept {
+        using reflected = uninttp_internals::en_reflected<E>;
+        const auto i = static_cast<std::uintmax_t>(static_cast<std::intmax_t>(value)) - static_cast<std::uintmax_t>(reflected::first);
+        if (i >= reflected::indices.size() || reflected::indices[i] == std::numeric_limits<typename reflected::slot_t>::max())
+            return {};
+        return reflected::names[reflected::indices[i]];
+    }
+
+    /**
+     * @brief Gives the enumerator of `E` named `name` through a perfect hash of the names, generated at compile time, followed by a single
+     * comparison; `std::nullopt` if there's none.
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    constexpr std::optional<E> enum_cast(const std::string_view name) noexcept {
+        using reflected = uninttp_internals::en_reflected<E>;
+        if constexpr (reflected::count == 0)
+            return std::nullopt;
+        else {
+            const std::size_t i = reflected::slots[reflected::hash(name)];
+            if (i < reflected::count && name == reflected::names[i])
+                return reflected::values[i];
+            return std::nullopt;
+        }
+    }
+}
+
+#endif /* UNINTTP_ENUM_NAME_HPP */
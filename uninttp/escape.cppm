@@ -0,0 +1,233 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.escape;
+
+import uninttp.uni_auto;
+import <type_traits>;
+import <string_view>;
+import <cstddef>;
+import <cstdint>;
+import <array>;
+
+export namespace uninttp::uninttp_internals {
+    inline constexpr char esc_hex_digits[] = "0123456789ABCDEF";
+
+    /* Decodes a `\u` escape of `s`, with `i` just past its `u`, into the UTF-8 bytes of `out`; a high surrogate takes along the `\u`
+       escape of the low surrogate that must follow it. Gives the number of bytes, or 0 if the escape is malformed or a surrogate is unpaired */
+    constexpr std::size_t esc_unescape_u(const std::string_view s, std::size_t& i, char (&out)[4]) noexcept {
+        const auto hex4 = [&] {
+            std::uint32_t cp = 0;
+            for (auto k = 0; k < 4; k++) {
+                const auto h = i < s.size() ? s[i++] : '\0';
+                cp <<= 4;
+                if (h >= '0' && h <= '9') cp |= static_cast<std::uint32_t>(h - '0');
+                else if (h >= 'a' && h <= 'f') cp |= static_cast<std::uint32_t>(h - 'a' + 10);
+                else if (h >= 'A' && h <= 'F') cp |= static_cast<std::uint32_t>(h - 'A' + 10);
+                else return std::uint32_t{ 0xFFFFFFFF };
+            }
+            return cp;
+        };
+        auto cp = hex4();
+        if (cp >= 0xD800 && cp < 0xDC00) {
+            if (s.substr(i, 2) != "\\u")
+                return 0;
+            i += 2;
+            const auto low = hex4();
+            if (low < 0xDC00 || low >= 0xE000)
+                return 0;
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        } else if ((cp >= 0xDC00 && cp < 0xE000) || cp > 0xFFFF)
+            return 0;
+        if (cp < 0x80) {
+            out[0] = static_cast<char>(cp);
+            return 1;
+        }
+        if (cp < 0x800) {
+            out[0] = static_cast<char>(0xC0 | (cp >> 6));
+            out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+    /* Each escaper writes the escaped form of `s` into `out` (if it isn't null) and gives its length */
+    struct json_escaper final {
+        static constexpr auto escape(const std::string_view s, char* out) noexcept {
+            std::size_t n = 0;
+            const auto put = [&](const char c) {
+                if (out)
+                    out[n] = c;
+                n++;
+            };
+            for (const auto c : s) {
+                const auto u = static_cast<unsigned char>(c);
+                switch (c) {
+                    case '"': put('\\'); put('"'); break;
+                    case '\\': put('\\'); put('\\'); break;
+                    case '\b': put('\\'); put('b'); break;
+                    case '\f': put('\\'); put('f'); break;
+                    case '\n': put('\\'); put('n'); break;
+                    case '\r': put('\\'); put('r'); break;
+                    case '\t': put('\\'); put('t'); break;
+                    default:
+                        if (u < 0x20) {
+                            for (const auto e : std::string_view("\\u00"))
+                                put(e);
+                            put(esc_hex_digits[u >> 4]);
+                            put(esc_hex_digits[u & 0xF]);
+                        } else
+                            put(c);
+                }
+            }
+            return n;
+        }
+    };
+
+    struct url_escaper final {
+        static constexpr auto escape(const std::string_view s, char* out) noexcept {
+            std::size_t n = 0;
+            const auto put = [&](const char c) {
+                if (out)
+                    out[n] = c;
+                n++;
+            };
+            for (const auto c : s) {
+                const auto u = static_cast<unsigned char>(c);
+                if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~')
+                    put(c);
+                else {
+                    put('%');
+                    put(esc_hex_digits[u >> 4]);
+                    put(esc_hex_digits[u & 0xF]);
+                }
+            }
+            return n;
+        }
+    };
+
+    struct csv_escaper final {
+        static constexpr auto escape(const std::string_view s, char* out) noexcept {
+            std::size_t n = 0;
+            const auto put = [&](const char c) {
+                if (out)
+                    out[n] = c;
+                n++;
+            };
+            put('"');
+            for (const auto c : s) {
+                if (c == '"')
+                    put('"');
+                put(c);
+            }
+            put('"');
+            return n;
+        }
+    };
+
+    struct html_escaper final {
+        static constexpr auto escape(const std::string_view s, char* out) noexcept {
+            std::size_t n = 0;
+            const auto put = [&](const std::string_view text) {
+                for (const auto c : text) {
+                    if (out)
+                        out[n] = c;
+                    n++;
+                }
+            };
+            for (const auto& c : s)
+                switch (c) {
+                    case '&': put("&amp;"); break;
+                    case '<': put("&lt;"); break;
+                    case '>': put("&gt;"); break;
+                    case '"': put("&quot;"); break;
+                    case '\'': put("&#39;"); break;
+                    default: put({ &c, 1 });
+                }
+            return n;
+        }
+    };
+
+    template <typename Escaper, std::size_t N>
+    constexpr auto esc_apply(const std::string_view s) noexcept {
+        std::array<char, N> out{};
+        Escaper::escape(s, out.data());
+        return out;
+    }
+
+    template <typename Escaper, uni_auto Value>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Value>)::value_type, char>
+    constexpr auto esc_escaped_v = to_uni_auto(esc_apply<Escaper, Escaper::escape(uni_auto_sv<Value>, nullptr) + 1>(uni_auto_sv<Value>));
+}
+
+export namespace uninttp {
+    /**
+     * @brief Escapes a string literal at compile time for use inside a JSON string (the surrounding quotes aren't added).
+     * @tparam Value The `uni_auto` string to escape
+     */
+    template <uni_auto Value>
+    constexpr auto json_escaped_v = uninttp_internals::esc_escaped_v<uninttp_internals::json_escaper, Value>;
+
+    /**
+     * @brief Percent-encodes every byte of a string literal at compile time except for the unreserved characters of RFC 3986.
+     * @tparam Value The `uni_auto` string to encode
+     */
+    template <uni_auto Value>
+    constexpr auto url_encoded_v = uninttp_internals::esc_escaped_v<uninttp_internals::url_escaper, Value>;
+
+    /**
+     * @brief Turns a string literal into a quoted CSV field (RFC 4180) at compile time.
+     * @tparam Value The `uni_auto` string to quote
+     */
+    template <uni_auto Value>
+    constexpr auto csv_quoted_v = uninttp_internals::esc_escaped_v<uninttp_internals::csv_escaper, Value>;
+
+    /**
+     * @brief Escapes the characters of a string literal that are special in HTML text and attribute values at compile time.
+     * @tparam Value The `uni_auto` string to escape
+     */
+    template <uni_auto Value>
+    constexpr auto html_escaped_v = uninttp_internals::esc_escaped_v<uninttp_internals::html_escaper, Value>;
+}
@@ -0,0 +1,114 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.field;
+
+import uninttp.uni_auto;
+import <type_traits>;
+
+namespace uninttp::uninttp_internals {
+    template <typename T>
+    struct member_pointer_traits;
+
+    template <typename T, typename C>
+    struct member_pointer_traits<T C::*> final {
+        using class_type = C;
+        using value_type = T;
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief Describes a data member of a class by pairing a pointer to it with a key (a name, a tag number, etc.).
+     * @tparam Key The `uni_auto` key
+     * @tparam Member The `uni_auto` pointer to the data member
+     */
+    template <uni_auto Key, uni_auto Member>
+        requires std::is_member_object_pointer_v<uni_auto_simplify_t<Member>>
+    struct field final {
+        using class_type = typename uninttp_internals::member_pointer_traits<uni_auto_simplify_t<Member>>::class_type;
+        using value_type = typename uninttp_internals::member_pointer_traits<uni_auto_simplify_t<Member>>::value_type;
+
+        static constexpr auto key = Key;
+        static constexpr auto member = uni_auto_simplify_v<Member>;
+
+        /**
+         * @brief Gives the member of `obj` described by the field.
+         */
+        static constexpr auto& get(class_type& obj) noexcept {
+            return obj.*member;
+        }
+
+        /**
+         * @brief Gives the member of `obj` described by the field.
+         */
+        static constexpr const auto& get(const class_type& obj) noexcept {
+            return obj.*member;
+        }
+    };
+}
+
+namespace uninttp::uninttp_internals {
+    template <typename T>
+    struct is_field final : std::false_type {};
+
+    template <uni_auto Key, uni_auto Member>
+    struct is_field<field<Key, Member>> final : std::true_type {};
+}
+
+export namespace uninttp {
+    /**
+     * @brief Checks whether `T` is a specialization of `field`.
+     */
+    template <typename T>
+    concept field_type = uninttp_internals::is_field<T>::value;
+}
+
+namespace uninttp::uninttp_internals {
+    template <typename Field, typename... Fields>
+    struct fields_class final {
+        static_assert((std::is_same_v<typename Field::class_type, typename Fields::class_type> && ...), "all the fields must belong to the same class");
+        using type = typename Field::class_type;
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief Gives the class that all of the fields belong to.
+     */
+    template <field_type... Fields>
+        requires (sizeof...(Fields) > 0)
+    using fields_class_t = typename uninttp_internals::fields_class<Fields...>::type;
+}
@@ -0,0 +1,309 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_FLAGS_HPP
+#define UNINTTP_FLAGS_HPP
+
+#include "uni_auto.hpp"
+#include "field.hpp"
+#include "json_reader.hpp"
+#include <system_error>
+#include <type_traits>
+#include <string_view>
+#include <charconv>
+#include <algorithm>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        template <typename T>
+        struct fl_is_char_array final : std::false_type {};
+
+        template <std::size_t N>
+        struct fl_is_char_array<char[N]> final : std::true_type {};
+
+        /* What the help text shows in place of a value of type `T` */
+        template <typename T>
+        constexpr std::string_view fl_hint() noexcept {
+            if constexpr (std::is_same_v<T, bool>)
+                return {};
+            else if constexpr (std::is_same_v<T, std::string_view> || fl_is_char_array<T>::value)
+                return "string";
+            else if constexpr (std::is_floating_point_v<T>)
+                return "number";
+            else if constexpr (std::is_enum_v<T> || std::is_signed_v<T>)
+                return "int";
+            else if constexpr (std::is_integral_v<T>)
+                return "uint";
+            else
+                static_assert(!sizeof(T), "flags: unsupported member type");
+        }
+
+        template <typename T>
+        std::errc fl_convert(const std::string_view text, T& out) noexcept {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                out = text;
+                return {};
+            } else if constexpr (fl_is_char_array<T>::value) {
+                if (text.size() >= std::extent_v<T>)
+                    return std::errc::value_too_large;
+                std::copy(text.begin(), text.end(), out);
+                out[text.size()] = '\0';
+                return {};
+            } else if constexpr (std::is_same_v<T, bool>) {
+                if (text == "1" || text == "true")
+                    out = true;
+                else if (text == "0" || text == "false")
+                    out = false;
+                else
+                    return std::errc::invalid_argument;
+                return {};
+            } else if constexpr (std::is_enum_v<T>) {
+                std::underlying_type_t<T> n{};
+                const auto ec = fl_convert(text, n);
+                if (ec == std::errc{})
+                    out = static_cast<T>(n);
+                return ec;
+            } else {
+                const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+                if (ec == std::errc{} && end != text.data() + text.size())
+                    return std::errc::invalid_argument;
+                return ec;
+            }
+        }
+    }
+
+    /**
+     * @brief Describes a command-line flag by pairing a pointer to the data member that it sets with its name and help text.
+     * @tparam Name The `uni_auto` name of the flag, as it's written after `--`
+     * @tparam Member The `uni_auto` pointer to the data member
+     * @tparam Help The `uni_auto` help text
+     */
+    template <uni_auto Name, uni_auto Member, uni_auto Help = "">
+        requires std::is_member_object_pointer_v<uni_auto_simplify_t<Member>>
+              && std::is_same_v<typename decltype(uni_auto_sv<Name>)::value_type, char>
+              && std::is_same_v<typename decltype(uni_auto_sv<Help>)::value_type, char>
+    struct flag final {
+        using field_type = field<Name, Member>;
+        using class_type = typename field_type::class_type;
+        using value_type = typename field_type::value_type;
+
+        static constexpr auto name = uni_auto_sv<Name>;
+        static constexpr auto help = uni_auto_sv<Help>;
+        static constexpr auto member = field_type::member;
+    };
+
+    /**
+     * @brief The outcome of parsing command-line arguments.
+     */
+    struct flags_result final {
+        int index; // The index of the first argument that isn't a flag, or of the flag at fault
+        std::errc ec;
+    };
+
+    /**
+     * @brief A command-line flag parser whose flag table, name lookup and help text all get generated at compile time.
+     *
+     * Flags are written as `--name=value` or `--name value`; flags of type `bool` can also be written as just `--name`. Names are
+     * looked up through a perfect hash of their length and two of their bytes, followed by a single comparison, and values are converted
+     * straight into the members that the flags describe. Nothing is registered at startup, and nothing is allocated. Supported member
+     * types are `bool` (`1`, `true`, `0` or `false`), integers, enumerations (read as their underlying integer), floating-point numbers,
+     * `std::string_view`s (which refer to the arguments themselves) and `char` arrays (null-terminated).
+     *
+     * @tparam Flags The `flag`s
+     */
+    template <typename... Flags>
+        requires (sizeof...(Flags) > 0)
+    struct flags final {
+    private:
+        using class_type = fields_class_t<typename Flags::field_type...>;
+
+        static constexpr std::array<std::string_view, sizeof...(Flags)> names = [] {
+            std::array<std::string_view, sizeof...(Flags)> out { Flags::name... };
+            for (std::size_t i = 0; i < out.size(); i++) {
+                if (out[i].empty() || out[i].front() == '-' || out[i].find_first_of("= ") != std::string_view::npos)
+                    uninttp_internals::compile_time_error("a flag's name must be non-empty and can't start with - or contain = or spaces");
+                for (std::size_t j = 0; j < i; j++)
+                    if (out[i] == out[j])
+                        uninttp_internals::compile_time_error("two flags have the same name");
+            }
+            return out;
+        }();
+
+        static constexpr auto hash = uninttp_internals::jr_perfect_hash(names);
+
+        using slot_t = std::conditional_t<sizeof...(Flags) < 0xFF, std::uint8_t, std::uint16_t>;
+
+        static constexpr auto slots = [] {
+            std::array<slot_t, std::size_t{ 1 } << hash.bits> out{};
+            out.fill(std::numeric_limits<slot_t>::max());
+            for (std::size_t i = 0; i < names.size(); i++)
+                out[hash(names[i])] = static_cast<slot_t>(i);
+            return out;
+        }();
+
+        template <typename Flag>
+        static std::errc member(const std::string_view value, class_type& obj) noexcept {
+            return uninttp_internals::fl_convert(value, obj.*Flag::member);
+        }
+
+        static constexpr std::errc (*members[])(std::string_view, class_type&) noexcept { &member<Flags>... };
+
+        static constexpr bool switches[] { std::is_same_v<typename Flags::value_type, bool>... };
+
+        static auto find(const std::string_view name) noexcept {
+            const std::size_t i = slots[hash(name)];
+            return i < names.size() && name == names[i] ? i : names.size();
+        }
+
+        /* Writes the help text to `out` (unless it's null), giving its length */
+        static constexpr std::size_t write_help(char* const out) noexcept {
+            constexpr std::array<std::string_view, sizeof...(Flags)> hints { uninttp_internals::fl_hint<typename Flags::value_type>()... };
+            constexpr std::array<std::string_view, sizeof...(Flags)> helps { Flags::help... };
+            constexpr auto width = [&] {
+                std::size_t n = 0;
+                for (std::size_t i = 0; i < names.size(); i++)
+                    n = std::max(n, names[i].size() + (hints[i].empty() ? 0 : hints[i].size() + 3));
+                return n;
+            }();
+            std::size_t n = 0;
+            const auto put = [&](const std::string_view s) {
+                if (out != nullptr)
+                    std::copy(s.begin(), s.end(), out + n);
+                n += s.size();
+            };
+            for (std::size_t i = 0; i < names.size(); i++) {
+                put("  --");
+                put(names[i]);
+                if (!hints[i].empty()) {
+                    put("=<");
+                    put(hints[i]);
+                    put(">");
+                }
+                if (!helps[i].empty()) {
+                    for (auto pad = names[i].size() + (hints[i].empty() ? 0 : hints[i].size() + 3); pad < width + 2; pad++)
+                        put(" ");
+                    put(helps[i]);
+                }
+                put("\n");
+            }
+            return n;
+        }
+
+        static constexpr auto help_storage = [] {
+            std::array<char, write_help(nullptr) + 1> out{};
+            write_help(out.data());
+            return out;
+        }();
+
+    public:
+        /**
+         * @brief The help text: one line per flag, showing its name, the kind of value that it takes and its help text (aligned).
+         */
+        static constexpr auto help = std::string_view { help_storage.data(), help_storage.size() - 1 };
+
+        /**
+         * @brief Parses the flags among `argv[1]` to `argv[argc - 1]` into `obj`.
+         *
+         * Parsing stops at the first argument that doesn't start with `--` or right after a lone `--`, so that positional arguments can
+         * follow the flags. Members whose flag is absent are left untouched; if a flag repeats, its last value wins.
+         *
+         * @return The index of the first argument past the flags and `std::errc{}` on success; otherwise the index of the argument at fault
+         * and `std::errc::invalid_argument` for unknown flags, missing values and malformed values, `std::errc::result_out_of_range` for
+         * numbers that don't fit their members or `std::errc::value_too_large` for strings that don't
+         */
+        static flags_result parse(const int argc, const char* const* const argv, class_type& obj) noexcept {
+            int i = 1;
+            for (; i < argc; i++) {
+                const std::string_view arg = argv[i];
+                if (!arg.starts_with("--"))
+                    break;
+                if (arg.size() == 2)
+                    return { i + 1, std::errc{} };
+                const auto eq = arg.find('=', 2);
+                const auto k = find(arg.substr(2, eq - 2));
+                if (k == names.size())
+                    return { i, std::errc::invalid_argument };
+                std::string_view value;
+                if (eq != std::string_view::npos)
+                    value = arg.substr(eq + 1);
+                else if (switches[k])
+                    value = "1";
+                else if (i + 1 < argc)
+                    value = argv[++i];
+                else
+                    return { i, std::errc::invalid_argument };
+                if (const auto ec = members[k](value, obj); ec != std::errc{})
+                    return { i, ec };
+            }
+            return { i, std::errc{} };
+        }
+
+        /**
+         * @brief Parses the flags' environment variables into `obj`: the name of a flag's variable is its own name, in upper case with
+         * dashes turned into underscores, after `Prefix` (e.g., `--max-threads` is read from `APP_MAX_THREADS` if `Prefix` is `"APP_"`).
+         *
+         * Members whose variable isn't set are left untouched, and values are read as they are after `=` on the command line.
+         *
+         * @tparam Prefix The `uni_auto` prefix of the variables' names
+         * @return `std::errc{}` on success; otherwise the error for the first variable at fault, as `parse()` gives it
+         */
+        template <uni_auto Prefix = "">
+            requires std::is_same_v<typename decltype(uni_auto_sv<Prefix>)::value_type, char>
+        static std::errc parse_env(class_type& obj) noexcept {
+            static constexpr auto variables = [] {
+                std::array<std::array<char, (uni_auto_sv<Prefix>.size() + std::max({ Flags::name.size()... }) + 1)>, sizeof...(Flags)> out{};
+                for (std::size_t i = 0; i < names.size(); i++) {
+                    std::copy(uni_auto_sv<Prefix>.begin(), uni_auto_sv<Prefix>.end(), out[i].begin());
+                    std::transform(names[i].begin(), names[i].end(), out[i].begin() + uni_auto_sv<Prefix>.size(), [](const char c) {
+                        return c == '-' ? '_' : c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+                    });
+                }
+                return out;
+            }();
+            for (std::size_t i = 0; i < names.size(); i++)
+                if (const char* const value = std::getenv(variables[i].data()); value != nullptr)
+                    if (const auto ec = members[i](value, obj); ec != std::errc{})
+                        return ec;
+            return {};
+        }
+    };
+}
+
+#endif /* UNINTTP_FLAGS_HPP */
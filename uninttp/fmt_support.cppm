@@ -46,3 +46,12 @@ struct fmt::formatter<uninttp::uni_auto<T>> : formatter<std::decay_t<T>> {
         return formatter<std::decay_t<T>>::format(a.operator typename uninttp::uni_auto<T>::type(), c);
     }
 };
+
+export template <typename T>
+    requires uninttp::uninttp_internals::ua_formattable_as_range<T>
+struct fmt::formatter<uninttp::uni_auto<T>> : uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>> {
+    template <typename FormatContext>
+    auto format(const uninttp::uni_auto<T>& a, FormatContext& c) const {
+        return uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>>::format(a.operator typename uninttp::uni_auto<T>::type(), c);
+    }
+};
@@ -0,0 +1,291 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.format;
+
+import uninttp.uni_auto;
+import uninttp.render;
+import <type_traits>;
+import <string_view>;
+import <algorithm>;
+import <iterator>;
+import <cstddef>;
+import <utility>;
+import <format>;
+import <array>;
+import <tuple>;
+
+namespace uninttp::uninttp_internals {
+    /* Either constant text (within the unescaped text) or a replacement field (whose spec lies within the format string) */
+    struct fm_item final {
+        bool field = false;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        std::size_t arg = 0;
+    };
+
+    struct fm_counts final {
+        std::size_t text_size = 0;
+        std::size_t item_count = 0;
+        std::size_t arg_count = 0;
+    };
+
+    /*
+     * Splits `format` into constant text (unescaped into `text`, if any) and replacement fields; describes both in `items` (if any).
+     * A field's spec spans from past its `:` (or its argument index) through its closing brace, which is what `std::formatter::parse()` expects.
+     */
+    constexpr auto fm_parse(const std::string_view format, char* const text, fm_item* const items) noexcept {
+        fm_counts out;
+        std::size_t start = 0, next_arg = 0;
+        auto automatic = false, manual = false;
+        const auto end_text = [&] {
+            if (out.text_size > start) {
+                if (items)
+                    items[out.item_count] = { false, start, out.text_size - start, 0 };
+                out.item_count++;
+            }
+        };
+        for (std::size_t i = 0; i < format.size(); i++) {
+            const auto c = format[i];
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+                i++;
+            else if (c == '{') {
+                end_text();
+                std::size_t arg = 0;
+                if (++i < format.size() && format[i] >= '0' && format[i] <= '9') {
+                    for (; i < format.size() && format[i] >= '0' && format[i] <= '9'; i++)
+                        arg = arg * 10 + static_cast<std::size_t>(format[i] - '0');
+                    manual = true;
+                } else {
+                    arg = next_arg++;
+                    automatic = true;
+                }
+                if (automatic && manual) {
+                    compile_time_error("automatic and manual argument indexing can't be mixed");
+                    return out;
+                }
+                if (i < format.size() && format[i] == ':')
+                    i++;
+                else if (i >= format.size() || format[i] != '}') {
+                    compile_time_error("malformed replacement field");
+                    return out;
+                }
+                const auto spec = i;
+                for (; i < format.size() && format[i] != '}'; i++)
+                    if (format[i] == '{') {
+                        compile_time_error("nested replacement fields (dynamic widths and precisions) are not supported");
+                        return out;
+                    }
+                if (i >= format.size()) {
+                    compile_time_error("unterminated replacement field");
+                    return out;
+                }
+                if (items)
+                    items[out.item_count] = { true, spec, i + 1 - spec, arg };
+                out.item_count++;
+                out.arg_count = std::max(out.arg_count, arg + 1);
+                start = out.text_size;
+                continue;
+            } else if (c == '}') {
+                compile_time_error("unmatched } (write }} for a literal one)");
+                return out;
+            }
+            if (text)
+                text[out.text_size] = c;
+            out.text_size++;
+        }
+        end_text();
+        return out;
+    }
+
+    template <uni_auto Format>
+    struct fm_parsed final {
+        static constexpr auto counts = fm_parse(uni_auto_sv<Format>, nullptr, nullptr);
+
+        static constexpr auto text = [] {
+            std::array<char, counts.text_size + 1> out{};
+            fm_parse(uni_auto_sv<Format>, out.data(), nullptr);
+            return out;
+        }();
+
+        static constexpr auto items = [] {
+            std::array<fm_item, counts.item_count> out{};
+            fm_parse(uni_auto_sv<Format>, nullptr, out.data());
+            return out;
+        }();
+    };
+
+    /* The formatter for the `Item`th item of `Format`, with its spec parsed once and for all */
+    template <uni_auto Format, std::size_t Item, typename T>
+    constexpr auto fm_formatter = [] {
+        constexpr auto item = fm_parsed<Format>::items[Item];
+        std::formatter<T, char> f;
+        std::format_parse_context context { uni_auto_sv<Format>.substr(item.offset, item.size) };
+        if (f.parse(context) != context.end() - 1)
+            compile_time_error("the format spec was not fully consumed");
+        return f;
+    }();
+
+    template <typename T, typename Formatter>
+    struct fm_arg final {
+        const Formatter& formatter;
+        const T& value;
+    };
+
+    template <uni_auto Format, std::size_t Item, typename... Args>
+    constexpr auto fm_wrap(const Args&... args) noexcept {
+        constexpr auto item = fm_parsed<Format>::items[Item];
+        static_assert(item.arg < sizeof...(Args), "format: too few arguments for the format string");
+        using T = std::remove_cvref_t<std::tuple_element_t<item.arg, std::tuple<Args...>>>;
+        return fm_arg<T, std::remove_cv_t<decltype(fm_formatter<Format, Item, T>)>> { fm_formatter<Format, Item, T>, std::get<item.arg>(std::tie(args...)) };
+    }
+
+    /*
+     * Writes the `Item`th item of `Format` to `out`: its text as it is, or its argument through the formatter parsed for it. A
+     * `std::format_context` can't be made outside of `std::format_to()` and the like, so each formatter is handed one through a `"{}"`
+     * of its own, which takes no scanning to speak of.
+     */
+    template <uni_auto Format, std::size_t Item, typename OutputIt, typename... Args>
+    OutputIt fm_put(OutputIt out, const Args&... args) {
+        constexpr auto item = fm_parsed<Format>::items[Item];
+        if constexpr (item.field)
+            return std::format_to(std::move(out), "{}", fm_wrap<Format, Item>(args...));
+        else
+            return std::copy_n(fm_parsed<Format>::text.data() + item.offset, item.size, std::move(out));
+    }
+
+    /* Like `fm_put()`, but writes at most `room` characters; gives the size that the item takes up in full along with the end */
+    template <uni_auto Format, std::size_t Item, typename OutputIt, typename... Args>
+    std::format_to_n_result<OutputIt> fm_put_n(OutputIt out, const std::iter_difference_t<OutputIt> room, const Args&... args) {
+        using difference_type = std::iter_difference_t<OutputIt>;
+        constexpr auto item = fm_parsed<Format>::items[Item];
+        if constexpr (item.field)
+            return std::format_to_n(std::move(out), std::max(room, difference_type{ 0 }), "{}", fm_wrap<Format, Item>(args...));
+        else {
+            const auto n = std::clamp(room, difference_type{ 0 }, static_cast<difference_type>(item.size));
+            return { std::copy_n(fm_parsed<Format>::text.data() + item.offset, n, std::move(out)), static_cast<difference_type>(item.size) };
+        }
+    }
+
+    /* Renders `Format` with `Values` at compile time, counting the characters instead if `data` is null */
+    template <uni_auto Format, uni_auto... Values>
+    constexpr auto fm_render(char* const data) noexcept {
+        using parsed = fm_parsed<Format>;
+        rd_output out { data };
+        for (const auto& item : parsed::items)
+            if (!item.field)
+                out.put(std::string_view { parsed::text.data() + item.offset, item.size });
+            else if (item.arg >= sizeof...(Values))
+                compile_time_error("too few arguments for the format string");
+            else {
+                [[maybe_unused]] const auto spec = uni_auto_sv<Format>.substr(item.offset, item.size - 1);
+                [[maybe_unused]] std::size_t i = 0;
+                ((i++ == item.arg ? rd_render(out, uni_auto_v<Values>, spec) : void()), ...);
+            }
+        return out.size;
+    }
+
+    template <uni_auto Format, uni_auto... Values>
+    constexpr auto fm_rendered = [] {
+        std::array<char, fm_render<Format, Values...>(nullptr) + 1> out{};
+        fm_render<Format, Values...>(out.data());
+        return out;
+    }();
+}
+
+export namespace uninttp {
+    /**
+     * @brief Formats `args` into `out` according to a format string whose replacement fields were split out and parsed at compile time.
+     *
+     * Each call copies the constant text as it is and runs the `std::formatter`s whose specs were parsed at compile time; the format
+     * string isn't scanned at runtime. Nested replacement fields (i.e., dynamic widths and precisions) are not supported.
+     *
+     * @tparam Format The `uni_auto` format string
+     * @return The end of the output
+     */
+    template <uni_auto Format, std::output_iterator<const char&> OutputIt, typename... Args>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Format>)::value_type, char>
+    OutputIt format(OutputIt out, const Args&... args) {
+        return [&]<std::size_t... Items>(std::index_sequence<Items...>) {
+            ((out = uninttp_internals::fm_put<Format, Items>(std::move(out), args...)), ...);
+            return out;
+        }(std::make_index_sequence<uninttp_internals::fm_parsed<Format>::items.size()>());
+    }
+
+    /**
+     * @brief Like `format()`, but writes at most `n` characters.
+     * @tparam Format The `uni_auto` format string
+     * @return The end of the output, and the size that the output would've taken up in full
+     */
+    template <uni_auto Format, std::output_iterator<const char&> OutputIt, typename... Args>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Format>)::value_type, char>
+    std::format_to_n_result<OutputIt> format_to_n(OutputIt out, const std::iter_difference_t<OutputIt> n, const Args&... args) {
+        std::format_to_n_result<OutputIt> result { std::move(out), 0 };
+        const auto put = [&]<std::size_t Item> {
+            auto [end, size] = uninttp_internals::fm_put_n<Format, Item>(std::move(result.out), n - result.size, args...);
+            result = { std::move(end), result.size + size };
+        };
+        [&]<std::size_t... Items>(std::index_sequence<Items...>) {
+            (put.template operator()<Items>(), ...);
+        }(std::make_index_sequence<uninttp_internals::fm_parsed<Format>::items.size()>());
+        return result;
+    }
+
+    /**
+     * @brief The output of formatting `Values` according to `Format`, rendered entirely at compile time into a null-terminated `uni_auto` string.
+     *
+     * `uni_auto_sv` views it as an `std::string_view`, and it can in turn be used as a format string or value.
+     * Values are rendered as `render_v` would render them (i.e., integers, floating-point values, characters, `bool`, enumerations, strings and arrays of those).
+     *
+     * @tparam Format The `uni_auto` format string
+     * @tparam Values The `uni_auto` values to format
+     */
+    template <uni_auto Format, uni_auto... Values>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Format>)::value_type, char>
+    constexpr auto format_v = to_uni_auto(uninttp_internals::fm_rendered<Format, Values...>);
+}
+
+
+export template <typename T, typename Formatter>
+struct std::formatter<uninttp::uninttp_internals::fm_arg<T, Formatter>> {
+    constexpr auto parse(format_parse_context& c) {
+        return c.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(const uninttp::uninttp_internals::fm_arg<T, Formatter>& a, FormatContext& c) const {
+        return a.formatter.format(a.value, c);
+    }
+};
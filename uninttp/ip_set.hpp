@@ -0,0 +1,396 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_IP_SET_HPP
+#define UNINTTP_IP_SET_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        /* An IPv6 address as two halves in host byte order, ordered as the address */
+        struct ips_v6 final {
+            std::uint64_t high = 0;
+            std::uint64_t low = 0;
+
+            friend constexpr bool operator==(const ips_v6&, const ips_v6&) noexcept = default;
+
+            /* Without short-circuiting, so that searches don't branch on it */
+            friend constexpr bool operator<=(const ips_v6& a, const ips_v6& b) noexcept {
+                return (a.high < b.high) | ((a.high == b.high) & (a.low <= b.low));
+            }
+
+            friend constexpr bool operator<(const ips_v6& a, const ips_v6& b) noexcept {
+                return !(b <= a);
+            }
+        };
+
+        constexpr bool ips_parse_v4(const std::string_view s, std::uint32_t& out) noexcept {
+            std::uint32_t value = 0, octet = 0;
+            std::size_t octets = 0, digits = 0;
+            for (std::size_t i = 0; i <= s.size(); i++) {
+                if (i == s.size() || s[i] == '.') {
+                    if (!digits || octet > 255 || ++octets > 4)
+                        return false;
+                    value = value << 8 | octet;
+                    octet = 0;
+                    digits = 0;
+                } else if (s[i] >= '0' && s[i] <= '9' && digits < 3) {
+                    octet = octet * 10 + static_cast<std::uint32_t>(s[i] - '0');
+                    digits++;
+                } else
+                    return false;
+            }
+            if (octets != 4)
+                return false;
+            out = value;
+            return true;
+        }
+
+        /* Parses groups of up to 4 hex digits, with at most one `::` and optionally a dotted IPv4 address in place of the last two groups */
+        constexpr bool ips_parse_v6(const std::string_view s, ips_v6& out) noexcept {
+            std::uint16_t groups[8] {};
+            std::size_t count = 0, gap = 8;
+            std::size_t i = 0;
+            if (s.starts_with("::")) {
+                gap = 0;
+                i = 2;
+            }
+            while (i < s.size()) {
+                const auto end = std::min(s.find(':', i), s.size());
+                const auto group = s.substr(i, end - i);
+                if (group.find('.') != std::string_view::npos) {
+                    std::uint32_t v4 = 0;
+                    if (end != s.size() || count > 6 || !ips_parse_v4(group, v4))
+                        return false;
+                    groups[count++] = static_cast<std::uint16_t>(v4 >> 16);
+                    groups[count++] = static_cast<std::uint16_t>(v4);
+                    break;
+                }
+                if (group.empty() || group.size() > 4 || count >= 8)
+                    return false;
+                std::uint16_t value = 0;
+                for (const auto c : group) {
+                    const auto digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+                    if (digit < 0)
+                        return false;
+                    value = static_cast<std::uint16_t>(value << 4 | digit);
+                }
+                groups[count++] = value;
+                if (end == s.size())
+                    break;
+                i = end + 1;
+                if (i < s.size() && s[i] == ':') {
+                    if (gap != 8)
+                        return false;
+                    gap = count;
+                    i++;
+                } else if (i == s.size())
+                    return false;
+            }
+            if (gap == 8 ? count != 8 : count >= 8)
+                return false;
+            /* Moves the groups after the `::` to the end */
+            std::uint16_t expanded[8] {};
+            for (std::size_t j = 0; j < count; j++)
+                expanded[j < gap ? j : j + 8 - count] = groups[j];
+            out = {};
+            for (std::size_t j = 0; j < 4; j++) {
+                out.high = out.high << 16 | expanded[j];
+                out.low = out.low << 16 | expanded[j + 4];
+            }
+            return true;
+        }
+
+        /* The addresses that a prefix covers, from `first` through `last` */
+        template <typename Address>
+        struct ips_interval final {
+            Address first{};
+            Address last{};
+        };
+
+        struct ips_prefix final {
+            bool v6 = false;
+            ips_interval<std::uint32_t> v4_range;
+            ips_interval<ips_v6> v6_range;
+        };
+
+        constexpr auto ips_parse_prefix(const std::string_view s) noexcept {
+            ips_prefix out;
+            const auto slash = std::min(s.find('/'), s.size());
+            const auto address = s.substr(0, slash);
+            out.v6 = address.find(':') != std::string_view::npos;
+            const unsigned bits = out.v6 ? 128 : 32;
+            unsigned length = bits;
+            if (slash != s.size()) {
+                const auto digits = s.substr(slash + 1);
+                length = 0;
+                if (digits.empty() || digits.size() > 3)
+                    compile_time_error("malformed prefix length");
+                for (const auto c : digits)
+                    if (c < '0' || c > '9')
+                        compile_time_error("malformed prefix length");
+                    else
+                        length = length * 10 + static_cast<unsigned>(c - '0');
+                if (length > bits)
+                    compile_time_error("prefix length out of range");
+            }
+            /* Host bits are cleared rather than rejected, so `10.1.2.3/8` covers `10.0.0.0/8` */
+            if (out.v6) {
+                ips_v6 a;
+                if (!ips_parse_v6(address, a))
+                    compile_time_error("malformed IPv6 address");
+                const auto host_high = length >= 64 ? 0 : ~std::uint64_t(0) >> length;
+                const auto host_low = length >= 128 ? 0 : length <= 64 ? ~std::uint64_t(0) : ~std::uint64_t(0) >> (length - 64);
+                out.v6_range = { { a.high & ~host_high, a.low & ~host_low }, { a.high | host_high, a.low | host_low } };
+            } else {
+                std::uint32_t a = 0;
+                if (!ips_parse_v4(address, a))
+                    compile_time_error("malformed IPv4 address");
+                const auto host = length >= 32 ? 0 : ~std::uint32_t(0) >> length;
+                out.v4_range = { a & ~host, a | host };
+            }
+            return out;
+        }
+
+        /* Whether `b` comes right after `a` */
+        constexpr bool ips_adjacent(const std::uint32_t a, const std::uint32_t b) noexcept {
+            return a != ~std::uint32_t(0) && b == a + 1;
+        }
+
+        constexpr bool ips_adjacent(const ips_v6& a, const ips_v6& b) noexcept {
+            return (a.high != ~std::uint64_t(0) || a.low != ~std::uint64_t(0)) && b == ips_v6 { a.high + (a.low == ~std::uint64_t(0)), a.low + 1 };
+        }
+
+        /* Sorts `ranges` and merges overlapping and adjacent ones in place, returning how many are left */
+        template <typename Address, std::size_t N>
+        constexpr auto ips_merge(std::array<ips_interval<Address>, N>& ranges, const std::size_t count) noexcept {
+            std::sort(ranges.begin(), ranges.begin() + count, [](const auto& a, const auto& b) { return a.first < b.first; });
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < count; i++)
+                if (n > 0 && (ranges[i].first <= ranges[n - 1].last || ips_adjacent(ranges[n - 1].last, ranges[i].first))) {
+                    if (ranges[n - 1].last < ranges[i].last)
+                        ranges[n - 1].last = ranges[i].last;
+                } else
+                    ranges[n++] = ranges[i];
+            return n;
+        }
+
+        /* The disjoint, sorted intervals that the prefixes of one address family cover, as parallel arrays of starts and ends */
+        template <typename Address, uni_auto... Prefixes>
+        struct ips_table final {
+            static constexpr auto merged = [] {
+                std::array<ips_interval<Address>, sizeof...(Prefixes)> ranges{};
+                std::size_t count = 0;
+                const auto add = [&](const ips_prefix& p) {
+                    if constexpr (std::is_same_v<Address, std::uint32_t>) {
+                        if (!p.v6)
+                            ranges[count++] = p.v4_range;
+                    } else if (p.v6)
+                        ranges[count++] = p.v6_range;
+                };
+                (add(ips_parse_prefix(uni_auto_sv<Prefixes>)), ...);
+                const auto n = ips_merge(ranges, count);
+                return std::pair { ranges, n };
+            }();
+
+            static constexpr std::size_t size = merged.second;
+
+            static constexpr auto firsts = [] {
+                std::array<Address, size> out{};
+                for (std::size_t i = 0; i < size; i++)
+                    out[i] = merged.first[i].first;
+                return out;
+            }();
+
+            static constexpr auto lasts = [] {
+                std::array<Address, size> out{};
+                for (std::size_t i = 0; i < size; i++)
+                    out[i] = merged.first[i].last;
+                return out;
+            }();
+
+            /* The halving steps of a binary search over `size` ranges */
+            static constexpr auto steps = [] {
+                std::array<std::size_t, std::bit_width(size) + 1> out{};
+                std::size_t count = 0;
+                for (auto n = size; n > 1; n -= n / 2)
+                    out[count++] = n / 2;
+                return std::pair { out, count };
+            }();
+
+            /* A branchless binary search for the last range starting at or before each of `a`, unrolled, and interleaved across `a` */
+            template <std::size_t Lanes, std::size_t... Steps>
+            static constexpr void search(const Address* const a, bool* const out, std::index_sequence<Steps...>) noexcept {
+                std::array<std::size_t, Lanes> base{};
+                [[maybe_unused]] const auto step = [&](const std::size_t half) {
+                    for (std::size_t j = 0; j < Lanes; j++)
+                        base[j] += (firsts[base[j] + half] <= a[j]) * half;
+                };
+                (step(steps.first[Steps]), ...);
+                for (std::size_t j = 0; j < Lanes; j++)
+                    out[j] = (firsts[base[j]] <= a[j]) & (a[j] <= lasts[base[j]]);
+            }
+
+            template <std::size_t Lanes>
+            static constexpr void contains(const Address* const a, bool* const out) noexcept {
+                if constexpr (size == 0)
+                    std::fill_n(out, Lanes, false);
+                else
+                    search<Lanes>(a, out, std::make_index_sequence<steps.second>());
+            }
+
+            static constexpr bool contains(const Address a) noexcept {
+                bool out = false;
+                contains<1>(&a, &out);
+                return out;
+            }
+        };
+
+        template <typename Address, typename Table>
+        constexpr std::size_t ips_contains_all(const Address* const first, const Address* const last, bool* const out) noexcept {
+            constexpr std::size_t lanes = 8;
+            const auto n = static_cast<std::size_t>(last - first);
+            std::size_t i = 0, hits = 0;
+            for (; i + lanes <= n; i += lanes)
+                Table::template contains<lanes>(first + i, out + i);
+            for (; i < n; i++)
+                out[i] = Table::contains(first[i]);
+            for (i = 0; i < n; i++)
+                hits += out[i];
+            return hits;
+        }
+    }
+
+    /**
+     * @brief A set of IPv4 and IPv6 prefixes (in CIDR notation) compiled into sorted, disjoint address ranges.
+     *
+     * Prefixes are parsed, sorted and merged at compile time; a lookup is a binary search without branches over the ranges of one address family.
+     * A prefix without a length stands for a single address, and any host bits set in a prefix are ignored. IPv4 addresses are given in host
+     * byte order (e.g., `ntohl(in.s_addr)`), and IPv6 addresses as their 16 bytes in network byte order (e.g., `in6.s6_addr`).
+     *
+     * @tparam Prefixes The `uni_auto` prefixes (e.g., `"10.0.0.0/8"` and `"2001:db8::/32"`)
+     */
+    template <uni_auto... Prefixes>
+        requires (std::is_same_v<typename decltype(uni_auto_sv<Prefixes>)::value_type, char> && ...)
+    struct ip_set final {
+    private:
+        using v4_table = uninttp_internals::ips_table<std::uint32_t, Prefixes...>;
+        using v6_table = uninttp_internals::ips_table<uninttp_internals::ips_v6, Prefixes...>;
+
+        static constexpr auto to_v6(const std::uint8_t* const bytes) noexcept {
+            uninttp_internals::ips_v6 out;
+            for (std::size_t i = 0; i < 8; i++) {
+                out.high = out.high << 8 | bytes[i];
+                out.low = out.low << 8 | bytes[i + 8];
+            }
+            return out;
+        }
+
+    public:
+        /**
+         * @brief The number of disjoint IPv4 address ranges that the set comes down to.
+         */
+        static constexpr std::size_t v4_range_count = v4_table::size;
+
+        /**
+         * @brief The number of disjoint IPv6 address ranges that the set comes down to.
+         */
+        static constexpr std::size_t v6_range_count = v6_table::size;
+
+        /**
+         * @brief Checks whether the IPv4 address `address` (in host byte order) falls within any of the prefixes.
+         */
+        static constexpr bool contains(const std::uint32_t address) noexcept {
+            return v4_table::contains(address);
+        }
+
+        /**
+         * @brief Checks whether the IPv6 address `address` (in network byte order) falls within any of the prefixes.
+         */
+        static constexpr bool contains(const std::array<std::uint8_t, 16>& address) noexcept {
+            return v6_table::contains(to_v6(address.data()));
+        }
+
+        /**
+         * @brief Checks whether the textual IPv4 or IPv6 address `address` falls within any of the prefixes.
+         * @return `false` if `address` is malformed
+         */
+        static constexpr bool contains(const std::string_view address) noexcept {
+            if (address.find(':') != std::string_view::npos) {
+                uninttp_internals::ips_v6 a;
+                return uninttp_internals::ips_parse_v6(address, a) && v6_table::contains(a);
+            }
+            std::uint32_t a = 0;
+            return uninttp_internals::ips_parse_v4(address, a) && v4_table::contains(a);
+        }
+
+        /**
+         * @brief Checks each IPv4 address in `[first, last)` (in host byte order), several at a time, storing the results in `out`.
+         * @return The number of addresses that fall within the set
+         */
+        static constexpr std::size_t contains(const std::uint32_t* const first, const std::uint32_t* const last, bool* const out) noexcept {
+            return uninttp_internals::ips_contains_all<std::uint32_t, v4_table>(first, last, out);
+        }
+
+        /**
+         * @brief Checks each IPv6 address in `[first, last)` (in network byte order), several at a time, storing the results in `out`.
+         * @return The number of addresses that fall within the set
+         */
+        static constexpr std::size_t contains(const std::array<std::uint8_t, 16>* const first, const std::array<std::uint8_t, 16>* const last, bool* const out) noexcept {
+            constexpr std::size_t lanes = 8;
+            const auto n = static_cast<std::size_t>(last - first);
+            std::size_t hits = 0;
+            for (std::size_t i = 0; i < n; i += lanes) {
+                uninttp_internals::ips_v6 block[lanes];
+                const auto m = std::min(lanes, n - i);
+                for (std::size_t j = 0; j < m; j++)
+                    block[j] = to_v6(first[i + j].data());
+                hits += uninttp_internals::ips_contains_all<uninttp_internals::ips_v6, v6_table>(block, block + m, out + i);
+            }
+            return hits;
+        }
+    };
+}
+
+#endif /* UNINTTP_IP_SET_HPP */
@@ -0,0 +1,442 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.json_reader;
+
+import uninttp.uni_auto;
+import uninttp.field;
+import uninttp.escape;
+import <system_error>;
+import <type_traits>;
+import <string_view>;
+import <charconv>;
+import <cstring>;
+import <cstddef>;
+import <cstdint>;
+import <algorithm>;
+import <limits>;
+import <array>;
+import <bit>;
+
+export namespace uninttp::uninttp_internals {
+    template <typename T>
+    struct jr_is_std_array final : std::false_type {};
+
+    template <typename T, std::size_t N>
+    struct jr_is_std_array<std::array<T, N>> final : std::true_type {};
+
+    /* Marks the bytes of `w` that are zero with their high bits; exact, unlike the cheaper test that can flag bytes past the first zero */
+    constexpr std::uint64_t jr_zero_bytes(const std::uint64_t w) noexcept {
+        constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+        return ~(((w & low_bits) + low_bits) | w | low_bits);
+    }
+
+    /* Finds the first `"` or `\` in `[p, last)`, eight bytes at a time */
+    inline const char* jr_find_quote(const char* p, const char* const last) noexcept {
+        constexpr std::uint64_t ones = 0x0101010101010101;
+        for (; last - p >= 8; p += 8) {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            if (const auto hits = jr_zero_bytes(w ^ (ones * '"')) | jr_zero_bytes(w ^ (ones * '\\')); hits != 0)
+                return p + (std::endian::native == std::endian::little ? std::countr_zero(hits) : std::countl_zero(hits)) / 8;
+        }
+        while (p != last && *p != '"' && *p != '\\')
+            p++;
+        return p;
+    }
+
+    /* Finds the first `"`, `{`, `[`, `}` or `]` in `[p, last)`, eight bytes at a time (setting bit 5 folds `[` onto `{` and `]` onto `}`) */
+    inline const char* jr_find_bracket(const char* p, const char* const last) noexcept {
+        constexpr std::uint64_t ones = 0x0101010101010101;
+        for (; last - p >= 8; p += 8) {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            const auto folded = w | (ones * 0x20);
+            if (const auto hits = jr_zero_bytes(w ^ (ones * '"')) | jr_zero_bytes(folded ^ (ones * '{')) | jr_zero_bytes(folded ^ (ones * '}')); hits != 0)
+                return p + (std::endian::native == std::endian::little ? std::countr_zero(hits) : std::countl_zero(hits)) / 8;
+        }
+        while (p != last && *p != '"' && *p != '{' && *p != '[' && *p != '}' && *p != ']')
+            p++;
+        return p;
+    }
+
+    /*
+     * Hashes a key by its length and two of its bytes, counted from the front and from the back respectively; a salt lets keys
+     * that repeat under different owners (e.g., the same segment leaving different nodes of a trie) share one table
+     */
+    struct jr_hash final {
+        std::uint32_t seed = 0;
+        std::size_t front = 0, back = 0;
+        int bits = 0;
+        bool whole = false; // Hash every byte instead, should no pair of bytes tell the keys apart
+
+        constexpr std::size_t operator()(const std::string_view k, const std::size_t salt = 0) const noexcept {
+            auto x = (static_cast<std::uint32_t>(salt) * 0x85EBCA77u + static_cast<std::uint32_t>(k.size())) * 0x9E3779B1u ^ seed;
+            if (whole)
+                for (const auto c : k)
+                    x = (x ^ static_cast<unsigned char>(c)) * 0x01000193u;
+            else {
+                x ^= static_cast<std::uint32_t>(front < k.size() ? static_cast<unsigned char>(k[front]) : 0) << 8;
+                x ^= static_cast<std::uint32_t>(back < k.size() ? static_cast<unsigned char>(k[k.size() - 1 - back]) : 0) << 16;
+            }
+            x = (x ^ (x >> 15)) * 0x85EBCA6Bu;
+            return x >> (32 - bits);
+        }
+    };
+
+    /* Searches for a hash that maps each of `keys` (salted with the matching `salts`), which must be distinct pairs, to a slot of its own */
+    template <std::size_t N>
+    constexpr auto jr_perfect_hash(const std::array<std::string_view, N>& keys, const std::array<std::size_t, N>& salts = {}) noexcept {
+        const auto min_bits = N <= 2 ? 1 : static_cast<int>(std::bit_width(N - 1));
+        const auto collision_free = [&](jr_hash h) {
+            std::array<bool, std::size_t{ 4 } << (N <= 2 ? 1 : std::bit_width(N - 1))> used{}; // Room for `min_bits + 2`
+            for (std::size_t i = 0; i < N; i++) {
+                const auto slot = h(keys[i], salts[i]);
+                if (used[slot])
+                    return false;
+                used[slot] = true;
+            }
+            return true;
+        };
+        for (auto bits = min_bits; bits <= min_bits + 2; bits++)
+            for (std::size_t front = 0; front < 8; front++)
+                for (std::size_t back = 0; back < 8; back++)
+                    for (std::uint32_t seed = 0; seed < 16; seed++)
+                        if (const jr_hash h { seed * 0x2545F491u, front, back, bits }; collision_free(h))
+                            return h;
+        for (std::uint32_t seed = 0; seed < 4096; seed++)
+            if (const jr_hash h { seed * 0x2545F491u, 0, 0, min_bits + 2, true }; collision_free(h))
+                return h;
+        compile_time_error("no perfect hash was found for the keys; there may be too many of them");
+        return jr_hash{};
+    }
+
+    /* Reads JSON values from `[p, last)`; on failure, `ec` tells why */
+    struct jr_cursor final {
+        const char* p;
+        const char* last;
+        std::errc ec{};
+
+        auto fail(const std::errc e = std::errc::invalid_argument) noexcept {
+            ec = e;
+            return false;
+        }
+
+        auto ws() noexcept {
+            while (p != last && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+                p++;
+        }
+
+        auto eat(const char c) noexcept {
+            ws();
+            if (p != last && *p == c) {
+                p++;
+                return true;
+            }
+            return false;
+        }
+
+        auto literal(const std::string_view word) noexcept {
+            if (static_cast<std::size_t>(last - p) < word.size() || std::memcmp(p, word.data(), word.size()) != 0)
+                return false;
+            p += word.size();
+            return true;
+        }
+
+        /* Reads a string without unescaping it; gives its raw contents */
+        auto raw_string(std::string_view& out) noexcept {
+            if (!eat('"'))
+                return fail();
+            const auto begin = p;
+            while (true) {
+                p = jr_find_quote(p, last);
+                if (p == last)
+                    return fail();
+                if (*p == '"')
+                    break;
+                if (last - p < 2)
+                    return fail();
+                p += 2;
+            }
+            out = { begin, static_cast<std::size_t>(p++ - begin) };
+            return true;
+        }
+
+        /* Unescapes the string at the current position into `out`, which must fit it along with its null terminator */
+        auto string(char* const out, const std::size_t capacity) noexcept {
+            std::string_view raw;
+            if (!raw_string(raw))
+                return false;
+            std::size_t n = 0;
+            const auto put = [&](const char c) {
+                if (n + 1 >= capacity)
+                    return false;
+                out[n++] = c;
+                return true;
+            };
+            for (std::size_t i = 0; i < raw.size();) {
+                if (raw[i] != '\\') {
+                    if (!put(raw[i++]))
+                        return fail(std::errc::value_too_large);
+                    continue;
+                }
+                auto ok = true;
+                switch (const auto e = raw[i + 1]; i += 2, e) {
+                    case '"': case '\\': case '/': ok = put(e); break;
+                    case 'b': ok = put('\b'); break;
+                    case 'f': ok = put('\f'); break;
+                    case 'n': ok = put('\n'); break;
+                    case 'r': ok = put('\r'); break;
+                    case 't': ok = put('\t'); break;
+                    case 'u': {
+                        char utf8[4]{};
+                        const auto k = esc_unescape_u(raw, i, utf8);
+                        if (k == 0)
+                            return fail();
+                        for (std::size_t m = 0; m < k && ok; m++)
+                            ok = put(utf8[m]);
+                        break;
+                    }
+                    default:
+                        return fail();
+                }
+                if (!ok)
+                    return fail(std::errc::value_too_large);
+            }
+            out[n] = '\0';
+            return true;
+        }
+
+        template <typename T>
+        auto number(T& out) noexcept {
+            ws();
+            if (p == last || (*p != '-' && (*p < '0' || *p > '9')))
+                return fail();
+            const auto [end, e] = std::from_chars(p, last, out);
+            if (e != std::errc{})
+                return fail(e == std::errc::result_out_of_range ? e : std::errc::invalid_argument);
+            p = end;
+            if constexpr (std::is_integral_v<T>)
+                if (p != last && (*p == '.' || *p == 'e' || *p == 'E'))
+                    return fail();
+            return true;
+        }
+
+        /* Steps over a value of any kind without looking into it more than it takes to find where it ends */
+        auto skip() noexcept {
+            ws();
+            if (p == last)
+                return fail();
+            if (*p == '"') {
+                std::string_view unused;
+                return raw_string(unused);
+            }
+            if (*p != '{' && *p != '[') {
+                const auto begin = p;
+                while (p != last && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+                    p++;
+                return p != begin || fail();
+            }
+            std::size_t depth = 0;
+            do {
+                p = jr_find_bracket(p, last);
+                if (p == last)
+                    return fail();
+                if (*p == '"') {
+                    std::string_view unused;
+                    if (!raw_string(unused))
+                        return false;
+                    continue;
+                }
+                depth += *p == '{' || *p == '[' ? 1 : -1;
+                p++;
+            } while (depth != 0);
+            return true;
+        }
+
+        template <typename T, std::size_t N>
+        auto elements(T* const out) noexcept {
+            if (!eat('['))
+                return fail();
+            if (eat(']'))
+                return true;
+            std::size_t n = 0;
+            do {
+                if (n == N)
+                    return fail(std::errc::value_too_large);
+                if (!value(out[n++]))
+                    return false;
+            } while (eat(','));
+            return eat(']') || fail();
+        }
+
+        template <typename T>
+        bool value(T& out) noexcept {
+            if constexpr (std::is_same_v<T, bool>) {
+                ws();
+                if (literal("true"))
+                    out = true;
+                else if (literal("false"))
+                    out = false;
+                else
+                    return fail();
+                return true;
+            } else if constexpr (std::is_enum_v<T>) {
+                std::underlying_type_t<T> v{};
+                if (!number(v))
+                    return false;
+                out = static_cast<T>(v);
+                return true;
+            } else if constexpr (std::is_arithmetic_v<T>)
+                return number(out);
+            else if constexpr (std::is_same_v<T, std::string_view>)
+                return raw_string(out);
+            else if constexpr (std::is_array_v<T>) {
+                if constexpr (std::is_same_v<std::remove_extent_t<T>, char>)
+                    return string(out, std::extent_v<T>);
+                else
+                    return elements<std::remove_extent_t<T>, std::extent_v<T>>(out);
+            } else if constexpr (jr_is_std_array<T>::value) {
+                if constexpr (std::is_same_v<typename T::value_type, char>)
+                    return string(out.data(), out.size());
+                else
+                    return elements<typename T::value_type, std::tuple_size_v<T>>(out.data());
+            } else
+                static_assert(!sizeof(T), "json_reader: unsupported member type");
+        }
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief A JSON deserializer whose key lookup gets generated at compile time.
+     *
+     * Keys are compared as they appear in the input against the fields' (JSON-escaped) names. Fields are first expected in their
+     * declared order, and a key that doesn't match the expected field is looked up through a perfect hash of its length and two of its
+     * bytes, followed by a single comparison; unknown keys have their values skipped. Input is parsed in place and nothing is allocated.
+     * Supported member types are `bool`, integers, enumerations (read as their underlying integer), floating-point numbers,
+     * `std::string_view`s (which refer to the input and keep escape sequences as they are), `char` arrays (unescaped and
+     * null-terminated) and arrays of any of those (read as JSON arrays).
+     *
+     * @tparam Fields The `field`s describing the members to be read, keyed by their names, which must be distinct
+     */
+    template <field_type... Fields>
+        requires (sizeof...(Fields) > 0 && (std::is_same_v<typename decltype(uni_auto_sv<Fields::key>)::value_type, char> && ...))
+    struct json_reader final {
+    private:
+        using class_type = fields_class_t<Fields...>;
+
+        template <typename Field>
+        static constexpr auto escaped_key = [] {
+            std::array<char, uninttp_internals::json_escaper::escape(uni_auto_sv<Field::key>, nullptr)> out{};
+            uninttp_internals::json_escaper::escape(uni_auto_sv<Field::key>, out.data());
+            return out;
+        }();
+
+        static constexpr std::array<std::string_view, sizeof...(Fields)> keys = [] {
+            std::array<std::string_view, sizeof...(Fields)> out { std::string_view { escaped_key<Fields>.data(), escaped_key<Fields>.size() }... };
+            for (std::size_t i = 0; i < out.size(); i++)
+                for (std::size_t j = 0; j < i; j++)
+                    if (out[i] == out[j])
+                        uninttp_internals::compile_time_error("two fields have the same key");
+            return out;
+        }();
+
+        static constexpr auto hash = uninttp_internals::jr_perfect_hash(keys);
+
+        using slot_t = std::conditional_t<sizeof...(Fields) < 0xFF, std::uint8_t, std::uint16_t>;
+
+        static constexpr auto slots = [] {
+            std::array<slot_t, std::size_t{ 1 } << hash.bits> out{};
+            out.fill(std::numeric_limits<slot_t>::max());
+            for (std::size_t i = 0; i < keys.size(); i++)
+                out[hash(keys[i])] = static_cast<slot_t>(i);
+            return out;
+        }();
+
+        template <typename Field>
+        static bool member(uninttp_internals::jr_cursor& c, class_type& obj) noexcept {
+            return c.value(Field::get(obj));
+        }
+
+        static constexpr bool (*members[])(uninttp_internals::jr_cursor&, class_type&) noexcept { &member<Fields>... };
+
+        static auto find(const std::string_view k, const std::size_t expected) noexcept {
+            if (expected < keys.size() && k == keys[expected])
+                return expected;
+            const std::size_t i = slots[hash(k)];
+            return i < keys.size() && k == keys[i] ? i : keys.size();
+        }
+
+    public:
+        /**
+         * @brief Reads a JSON object from `[first, last)` into `obj`.
+         *
+         * Members whose key is absent are left untouched; if a key repeats, its last value wins. Whatever follows the object is not looked at.
+         *
+         * @return Like `std::from_chars()`, the end of the object and `std::errc{}` on success; otherwise the position where reading stopped
+         * and `std::errc::invalid_argument` for malformed input, `std::errc::result_out_of_range` for numbers that don't fit their members
+         * or `std::errc::value_too_large` for strings and arrays that don't
+         */
+        static std::from_chars_result read(const char* const first, const char* const last, class_type& obj) noexcept {
+            uninttp_internals::jr_cursor c { first, last };
+            const auto ok = [&] {
+                if (!c.eat('{'))
+                    return c.fail();
+                if (c.eat('}'))
+                    return true;
+                std::size_t expected = 0;
+                do {
+                    std::string_view k;
+                    if (!c.raw_string(k) || !c.eat(':'))
+                        return c.fail(c.ec == std::errc{} ? std::errc::invalid_argument : c.ec);
+                    const auto i = find(k, expected);
+                    if (i == keys.size() ? !c.skip() : !members[i](c, obj))
+                        return false;
+                    expected = i + 1;
+                } while (c.eat(','));
+                return c.eat('}') || c.fail();
+            }();
+            return { c.p, ok ? std::errc{} : c.ec };
+        }
+
+        /**
+         * @brief Reads a JSON object from `json` into `obj`.
+         */
+        static std::from_chars_result read(const std::string_view json, class_type& obj) noexcept {
+            return read(json.data(), json.data() + json.size(), obj);
+        }
+    };
+}
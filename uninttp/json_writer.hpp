@@ -0,0 +1,182 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_JSON_WRITER_HPP
+#define UNINTTP_JSON_WRITER_HPP
+
+#include "uni_auto.hpp"
+#include "field.hpp"
+#include "escape.hpp"
+#include <system_error>
+#include <type_traits>
+#include <string_view>
+#include <charconv>
+#include <cstring>
+#include <cstddef>
+#include <limits>
+#include <array>
+#include <cmath>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        template <typename T>
+        concept jw_string = std::is_convertible_v<const T&, std::string_view>;
+
+        /* Gives the most characters that a value of type `T` can take up, or 0 if that isn't bounded */
+        template <typename T>
+        constexpr std::size_t jw_max_width() noexcept {
+            if constexpr (std::is_same_v<T, bool>)
+                return 5;
+            else if constexpr (std::is_enum_v<T>)
+                return jw_max_width<std::underlying_type_t<T>>();
+            else if constexpr (std::is_integral_v<T>)
+                return std::numeric_limits<T>::digits10 + 2;
+            else if constexpr (std::is_floating_point_v<T>)
+                return std::numeric_limits<T>::max_digits10 + 8; // Sign, decimal point and exponent
+            else
+                return 0;
+        }
+
+        /* The constant text that precedes the value of a field, i.e., `{"key":` for the first field and `,"key":` for the rest */
+        template <uni_auto Key, bool First>
+        constexpr auto jw_prefix() noexcept {
+            constexpr auto key = uni_auto_sv<Key>;
+            std::array<char, json_escaper::escape(key, nullptr) + 4> out{};
+            out[0] = First ? '{' : ',';
+            out[1] = '"';
+            json_escaper::escape(key, out.data() + 2);
+            out[out.size() - 2] = '"';
+            out[out.size() - 1] = ':';
+            return out;
+        }
+
+        template <bool Checked, typename T>
+        char* jw_value(char* p, char* const last, const T& v) noexcept {
+            if constexpr (jw_string<T>) {
+                const std::string_view s = v;
+                if (static_cast<std::size_t>(last - p) < 6 * s.size() + 2 && static_cast<std::size_t>(last - p) < json_escaper::escape(s, nullptr) + 2)
+                    return nullptr;
+                *p++ = '"';
+                p += json_escaper::escape(s, p);
+                *p++ = '"';
+                return p;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                const std::size_t n = v ? 4 : 5;
+                if (Checked && static_cast<std::size_t>(last - p) < n)
+                    return nullptr;
+                std::memcpy(p, v ? "true" : "false", n);
+                return p + n;
+            } else if constexpr (std::is_enum_v<T>)
+                return jw_value<Checked>(p, last, static_cast<std::underlying_type_t<T>>(v));
+            else {
+                if constexpr (std::is_floating_point_v<T>)
+                    if (!std::isfinite(v)) {
+                        if (Checked && last - p < 4)
+                            return nullptr;
+                        std::memcpy(p, "null", 4);
+                        return p + 4;
+                    }
+                const auto [end, ec] = std::to_chars(p, last, v);
+                return ec == std::errc{} ? end : nullptr;
+            }
+        }
+    }
+
+    /**
+     * @brief A JSON serializer whose keys and separators get rendered at compile time.
+     *
+     * Writing an object boils down to copying the constant fragments and formatting the values in between; nothing gets allocated.
+     * Supported member types are `bool`, integers, enumerations (written as their underlying integer), floating-point numbers
+     * (non-finite ones are written as `null`) and anything convertible to `std::string_view` (escaped at runtime).
+     *
+     * @tparam Fields The `field`s describing the members to write, keyed by their names
+     */
+    template <field_type... Fields>
+        requires (sizeof...(Fields) > 0 && (std::is_same_v<typename decltype(uni_auto_sv<Fields::key>)::value_type, char> && ...))
+    struct json_writer final {
+    private:
+        using class_type = fields_class_t<Fields...>;
+
+        template <std::size_t Index, typename Field>
+        static constexpr auto prefix = uninttp_internals::jw_prefix<Field::key, Index == 0>();
+
+        static constexpr auto bounded = ((uninttp_internals::jw_max_width<std::remove_cvref_t<typename Fields::value_type>>() > 0) && ...);
+
+        template <bool Checked, std::size_t Index, typename Field>
+        static auto put(char*& p, char* const last, const class_type& obj) noexcept {
+            constexpr auto& text = prefix<Index, Field>;
+            if constexpr (Checked)
+                if (static_cast<std::size_t>(last - p) < text.size())
+                    return false;
+            std::memcpy(p, text.data(), text.size());
+            p = uninttp_internals::jw_value<Checked>(p + text.size(), last, Field::get(obj));
+            return p != nullptr;
+        }
+
+        template <bool Checked>
+        static auto put_all(char* p, char* const last, const class_type& obj) noexcept -> char* {
+            const auto ok = [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                return (put<Checked, Indices, Fields>(p, last, obj) && ...);
+            }(std::index_sequence_for<Fields...>());
+            if (!ok || (Checked && p == last))
+                return nullptr;
+            *p++ = '}';
+            return p;
+        }
+
+    public:
+        /**
+         * @brief The most characters that an object can take up, or 0 if some field (e.g., a string) isn't bounded.
+         */
+        static constexpr std::size_t max_size = bounded ? (1 + ... + (prefix<0, Fields>.size() + uninttp_internals::jw_max_width<std::remove_cvref_t<typename Fields::value_type>>())) : 0;
+
+        /**
+         * @brief Writes `obj` as a JSON object into `[first, last)`.
+         * @return Like `std::to_chars()`, the end of the output and `std::errc{}` on success, or `last` and `std::errc::value_too_large` if it didn't fit
+         */
+        static std::to_chars_result write(char* const first, char* const last, const class_type& obj) noexcept {
+            char* p;
+            if (bounded && static_cast<std::size_t>(last - first) >= max_size)
+                p = put_all<false>(first, last, obj);
+            else
+                p = put_all<true>(first, last, obj);
+            if (p == nullptr)
+                return { last, std::errc::value_too_large };
+            return { p, std::errc{} };
+        }
+    };
+}
+
+#endif /* UNINTTP_JSON_WRITER_HPP */
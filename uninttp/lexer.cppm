@@ -0,0 +1,183 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.lexer;
+
+import uninttp.uni_auto;
+import uninttp.regex;
+import <type_traits>;
+import <string_view>;
+import <functional>;
+import <optional>;
+import <cstddef>;
+import <cstdint>;
+import <array>;
+
+namespace uninttp::uninttp_internals {
+    /* Joins the NFAs of all the rules under one start state; the `match` instruction of each rule carries the rule's index */
+    template <std::size_t K>
+    constexpr auto lx_compile(const std::array<std::string_view, K>& rules) {
+        re_program prog{};
+        auto start = re_npos;
+        for (auto k = K; k-- > 0;) {
+            re_parser parser{};
+            parser.pattern = rules[k];
+            const auto root = parser.alternation();
+            if (!parser.done())
+                compile_time_error("unbalanced )");
+            prog.insts.push_back({ .op = re_op::match, .slot = k });
+            const auto body = re_emit(parser.nodes, prog.insts, root, prog.insts.size() - 1);
+            if (start == re_npos)
+                start = body;
+            else {
+                prog.insts.push_back({ .op = re_op::split, .out = body, .out1 = start });
+                start = prog.insts.size() - 1;
+            }
+        }
+        prog.start = start;
+        return prog;
+    }
+
+    template <std::size_t States, std::size_t Classes>
+    struct lx_tables final {
+        std::array<std::uint8_t, 256> classes{};
+        std::array<re_state_t<States>, States * Classes> delta{};
+        std::array<std::size_t, States> accept{};
+    };
+
+    template <std::size_t States, std::size_t Classes>
+    constexpr auto lx_freeze(const re_dfa& dfa) {
+        lx_tables<States, Classes> t{};
+        t.classes = dfa.classes;
+        for (std::size_t k = 0; k < dfa.delta.size(); k++)
+            t.delta[k] = static_cast<re_state_t<States>>(dfa.delta[k]);
+        for (std::size_t s = 0; s < States; s++)
+            t.accept[s] = dfa.accept[s];
+        if (t.accept[1] != re_npos)
+            compile_time_error("a rule cannot match the empty string");
+        return t;
+    }
+}
+
+export namespace uninttp {
+    /**
+     * @brief A maximal-munch scanner generated at compile time from a list of token rules.
+     *
+     * Each rule is a pattern in the syntax supported by `regex` (use `regex_escaped_v` for literal spellings such as operators). At every
+     * position the longest match wins, and among matches of equal length the rule listed first wins, so keywords should come before the
+     * identifier rule. The kind of a token is the index of the rule that produced it.
+     *
+     * @tparam Rules The `uni_auto` strings holding the token rules
+     */
+    template <uni_auto... Rules>
+        requires (sizeof...(Rules) > 0 && (std::is_same_v<typename decltype(uni_auto_sv<Rules>)::value_type, char> && ...))
+    struct lexer final {
+    private:
+        static constexpr std::array<std::string_view, sizeof...(Rules)> rules { uni_auto_sv<Rules>... };
+        static constexpr auto program_size = uninttp_internals::lx_compile(rules).insts.size();
+        static constexpr auto program = uninttp_internals::re_freeze<program_size>(uninttp_internals::lx_compile(rules));
+        static constexpr auto shape = uninttp_internals::re_shape(program.insts, program.start);
+        static constexpr auto tables = uninttp_internals::lx_freeze<shape.states, shape.classes>(uninttp_internals::re_determinize(program.insts, program.start));
+
+        std::string_view input;
+        std::size_t pos = 0;
+
+    public:
+        /**
+         * @brief The kind given to a byte that doesn't begin any token.
+         */
+        static constexpr auto error = sizeof...(Rules);
+
+        struct token final {
+            std::size_t kind;
+            std::size_t offset;
+            std::string_view text;
+        };
+
+        /**
+         * @brief Starts scanning `text` at `offset`.
+         *
+         * Tokens only depend on where scanning starts, so any offset previously obtained from `offset()` is a valid place to resume
+         * from, e.g., after the text that follows it was edited.
+         */
+        constexpr explicit lexer(const std::string_view text, const std::size_t offset = 0) noexcept : input{ text }, pos{ offset } {}
+
+        /**
+         * @brief Gives the offset at which the next token begins; pass it back to the constructor to resume scanning from there.
+         */
+        constexpr auto offset() const noexcept {
+            return pos;
+        }
+
+        /**
+         * @brief Scans the next token, or gives `std::nullopt` at the end of the input.
+         */
+        constexpr auto next() noexcept -> std::optional<token> {
+            if (pos >= input.size())
+                return std::nullopt;
+            std::size_t state = 1;
+            auto end = pos + 1;
+            auto kind = error;
+            for (auto i = pos; i < input.size(); i++) {
+                state = tables.delta[state * shape.classes + tables.classes[static_cast<unsigned char>(input[i])]];
+                if (state == 0)
+                    break;
+                if (tables.accept[state] != uninttp_internals::re_npos) {
+                    end = i + 1;
+                    kind = tables.accept[state];
+                }
+            }
+            const token t{ kind, pos, input.substr(pos, end - pos) };
+            pos = end;
+            return t;
+        }
+
+        /**
+         * @brief Invokes `f` with every remaining token; returning `false` from `f` stops the scan.
+         */
+        template <typename F>
+            requires std::is_invocable_v<F&, const token&>
+        constexpr auto for_each(F&& f) {
+            while (const auto t = next()) {
+                if constexpr (std::is_same_v<std::invoke_result_t<F&, const token&>, bool>) {
+                    if (!std::invoke(f, *t))
+                        return false;
+                } else
+                    std::invoke(f, *t);
+            }
+            return true;
+        }
+    };
+}
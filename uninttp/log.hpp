@@ -0,0 +1,296 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_LOG_HPP
+#define UNINTTP_LOG_HPP
+
+#include "uni_auto.hpp"
+#include "format.hpp"
+#include <type_traits>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <tuple>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        /* What a record's ID points to: emitted once per format string and argument types as a constant, so there's nothing to register at runtime */
+        struct lg_meta final {
+            std::string_view format;
+            void (*decode)(const std::byte*, std::string&);
+        };
+
+        /* Precedes each record's argument bytes in a ring; a null `meta` marks the padding that skips the ring's tail end */
+        struct lg_header final {
+            const lg_meta* meta;
+            std::size_t size;
+        };
+
+        /* Records start at multiples of this, so whatever is left before the end of a ring is either nothing or room for a header */
+        inline constexpr std::size_t lg_align = sizeof(lg_header);
+
+        /* Strings are copied into the record (as a 32-bit length and the characters); anything else is copied as is */
+        template <typename T>
+        using lg_stored_t = std::conditional_t<std::is_convertible_v<const T&, std::string_view>, std::string_view, std::remove_cvref_t<T>>;
+
+        template <typename T>
+        constexpr std::size_t lg_clamp(const T& value) noexcept {
+            if constexpr (std::is_same_v<lg_stored_t<T>, std::string_view>)
+                return std::min<std::size_t>(std::string_view(value).size(), std::numeric_limits<std::uint32_t>::max());
+            else
+                return 0;
+        }
+
+        template <typename T>
+        constexpr std::size_t lg_size(const T& value) noexcept {
+            if constexpr (std::is_same_v<lg_stored_t<T>, std::string_view>)
+                return sizeof(std::uint32_t) + lg_clamp(value);
+            else
+                return sizeof(T);
+        }
+
+        template <typename T>
+        std::byte* lg_store(std::byte* p, const T& value) noexcept {
+            if constexpr (std::is_same_v<lg_stored_t<T>, std::string_view>) {
+                const std::string_view s = value;
+                const auto size = static_cast<std::uint32_t>(lg_clamp(value));
+                std::memcpy(p, &size, sizeof size);
+                std::memcpy(p + sizeof size, s.data(), size);
+                return p + sizeof size + size;
+            } else {
+                std::memcpy(p, std::addressof(value), sizeof(T));
+                return p + sizeof(T);
+            }
+        }
+
+        template <typename T>
+        T lg_load(const std::byte*& p) noexcept {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                std::uint32_t size;
+                std::memcpy(&size, p, sizeof size);
+                const std::string_view s { reinterpret_cast<const char*>(p + sizeof size), size };
+                p += sizeof size + size;
+                return s;
+            } else {
+                std::array<std::byte, sizeof(T)> bytes;
+                std::memcpy(bytes.data(), p, sizeof(T));
+                p += sizeof(T);
+                return std::bit_cast<T>(bytes);
+            }
+        }
+
+        template <uni_auto Format, typename... Stored>
+        void lg_decode([[maybe_unused]] const std::byte* p, std::string& out) {
+            /* Braced initialization evaluates the loads left to right */
+            const std::tuple<Stored...> values { lg_load<Stored>(p)... };
+            std::apply([&](const auto&... args) { uninttp::format<Format>(std::back_inserter(out), args...); }, values);
+        }
+
+        template <uni_auto Format, typename... Stored>
+        inline constexpr lg_meta lg_meta_v { uni_auto_sv<Format>, &lg_decode<Format, Stored...> };
+
+        /* A single-producer, single-consumer ring of records; `head` and `tail` count bytes and only ever grow */
+        struct lg_ring final {
+            explicit lg_ring(const std::size_t capacity) : buffer(new std::byte[capacity]), mask(capacity - 1) {}
+
+            const std::unique_ptr<std::byte[]> buffer;
+            const std::size_t mask;
+            /* The producer's and the consumer's sides each get a cache line of their own */
+            alignas(64) std::atomic<std::size_t> head = 0;
+            std::size_t cached_tail = 0;
+            alignas(64) std::atomic<std::size_t> tail = 0;
+            std::atomic<bool> retired = false;
+
+            template <typename Store>
+            bool write(const lg_meta* const meta, const std::size_t size, Store store) noexcept {
+                const auto total = (sizeof(lg_header) + size + lg_align - 1) & ~(lg_align - 1);
+                const auto capacity = mask + 1;
+                if (total > capacity)
+                    return false;
+                const auto wait_for = [&](const std::size_t h, const std::size_t n) {
+                    while (capacity - (h - cached_tail) < n) {
+                        cached_tail = tail.load(std::memory_order_acquire);
+                        if (capacity - (h - cached_tail) < n)
+                            std::this_thread::yield();
+                    }
+                };
+                auto h = head.load(std::memory_order_relaxed);
+                if (const auto room = capacity - (h & mask); room < total) {
+                    /* The padding gets published on its own, as waiting for it and the record together could take more than the whole ring */
+                    wait_for(h, room);
+                    const lg_header padding { nullptr, room - sizeof(lg_header) };
+                    std::memcpy(buffer.get() + (h & mask), &padding, sizeof padding);
+                    h += room;
+                    head.store(h, std::memory_order_release);
+                }
+                wait_for(h, total);
+                const auto p = buffer.get() + (h & mask);
+                const lg_header header { meta, size };
+                std::memcpy(p, &header, sizeof header);
+                store(p + sizeof header);
+                head.store(h + total, std::memory_order_release);
+                return true;
+            }
+
+            /* Called by the consumer only */
+            template <typename Sink>
+            std::size_t drain(std::string& line, Sink& sink) {
+                std::size_t n = 0;
+                auto t = tail.load(std::memory_order_relaxed);
+                for (const auto h = head.load(std::memory_order_acquire); t != h;) {
+                    lg_header header;
+                    std::memcpy(&header, buffer.get() + (t & mask), sizeof header);
+                    if (header.meta) {
+                        line.clear();
+                        header.meta->decode(buffer.get() + (t & mask) + sizeof header, line);
+                        sink(std::string_view(line));
+                        n++;
+                    }
+                    t += (sizeof(lg_header) + header.size + lg_align - 1) & ~(lg_align - 1);
+                    tail.store(t, std::memory_order_release);
+                }
+                return n;
+            }
+        };
+
+        struct lg_registry final {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<lg_ring>> rings;
+            std::atomic<std::size_t> capacity = std::size_t(1) << 20;
+
+            static lg_registry& instance() {
+                static lg_registry registry;
+                return registry;
+            }
+        };
+
+        /* Owns the calling thread's ring, and leaves it for the consumer to drain and drop once the thread exits */
+        struct lg_thread_ring final {
+            std::shared_ptr<lg_ring> ring;
+
+            ~lg_thread_ring() {
+                if (ring)
+                    ring->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        inline lg_ring& lg_make_ring() {
+            thread_local lg_thread_ring owner;
+            auto& registry = lg_registry::instance();
+            owner.ring = std::make_shared<lg_ring>(registry.capacity.load(std::memory_order_relaxed));
+            const std::lock_guard lock { registry.mutex };
+            registry.rings.push_back(owner.ring);
+            return *owner.ring;
+        }
+
+        inline lg_ring& lg_local_ring() {
+            /* A plain pointer, so that finding the ring doesn't take a thread-local guard check on every call */
+            thread_local lg_ring* ring = nullptr;
+            if (!ring) [[unlikely]]
+                ring = &lg_make_ring();
+            return *ring;
+        }
+    }
+
+    /**
+     * @brief Sets the size of the ring buffer of every thread that has yet to log anything (1 MiB by default).
+     * @param size The size in bytes, rounded up to a power of two
+     */
+    inline void set_log_buffer_size(const std::size_t size) noexcept {
+        uninttp_internals::lg_registry::instance().capacity.store(std::bit_ceil(std::max(size, 2 * uninttp_internals::lg_align)), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Logs an event without formatting it: copies a pointer to the format string's constant metadata and the raw arguments into the calling thread's ring buffer.
+     *
+     * Formatting is deferred to whoever calls `log_drain()`, with the specs of the format string parsed at compile time (see `format()`).
+     * Strings (anything convertible to `std::string_view`) are copied into the record; every other argument must be trivially copyable.
+     * Should the ring be full, the call waits for the consumer to make room rather than drop the event. The first call on each thread
+     * allocates that thread's ring buffer, and may throw if that fails.
+     *
+     * @tparam Format The `uni_auto` format string
+     * @return `false` if the record can't fit even in an empty ring buffer (and was dropped), `true` otherwise
+     */
+    template <uni_auto Format, typename... Args>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Format>)::value_type, char>
+    bool log(const Args&... args) {
+        static_assert((std::is_trivially_copyable_v<uninttp_internals::lg_stored_t<Args>> && ...), "log: arguments must be strings or trivially copyable");
+        constexpr auto meta = &uninttp_internals::lg_meta_v<Format, uninttp_internals::lg_stored_t<Args>...>;
+        return uninttp_internals::lg_local_ring().write(meta, (uninttp_internals::lg_size(args) + ... + 0), [&]([[maybe_unused]] std::byte* p) noexcept {
+            ((p = uninttp_internals::lg_store(p, args)), ...);
+        });
+    }
+
+    /**
+     * @brief Formats and hands over every event logged so far, thread by thread, and frees up the buffers of threads that have exited.
+     *
+     * Meant to be called in a loop by a background thread; events from the same thread come in order.
+     *
+     * @param sink Called with each formatted event as a `std::string_view` (valid only for the duration of the call)
+     * @return The number of events handed over
+     */
+    template <typename Sink>
+    std::size_t log_drain(Sink&& sink) {
+        auto& registry = uninttp_internals::lg_registry::instance();
+        thread_local std::string line;
+        std::size_t n = 0;
+        const std::lock_guard lock { registry.mutex };
+        for (auto it = registry.rings.begin(); it != registry.rings.end();) {
+            auto& ring = **it;
+            const auto retired = ring.retired.load(std::memory_order_acquire);
+            n += ring.drain(line, sink);
+            if (retired && ring.tail.load(std::memory_order_relaxed) == ring.head.load(std::memory_order_acquire))
+                it = registry.rings.erase(it);
+            else
+                ++it;
+        }
+        return n;
+    }
+}
+
+#endif /* UNINTTP_LOG_HPP */
@@ -0,0 +1,210 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_MESSAGE_TEMPLATE_HPP
+#define UNINTTP_MESSAGE_TEMPLATE_HPP
+
+#include "uni_auto.hpp"
+#include "binary_layout.hpp"
+#include <type_traits>
+#include <string_view>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    /**
+     * @brief How a runtime value gets written into a `patch`.
+     */
+    enum class patch_encoding {
+        big_endian,    // An integer (or enumeration), in binary
+        little_endian, // An integer (or enumeration), in binary
+        decimal,       // A non-negative integer, in ASCII digits padded with leading zeros
+        text           // A string, padded with trailing spaces
+    };
+
+    /**
+     * @brief Describes a slot within a `message_template` that a runtime value gets written into.
+     * @tparam Offset The offset of the slot within the message
+     * @tparam Width The width of the slot
+     * @tparam Encoding How the value is written
+     */
+    template <std::size_t Offset, std::size_t Width, patch_encoding Encoding = patch_encoding::big_endian>
+        requires (Width > 0 && (Width <= 8 || Encoding == patch_encoding::text || Encoding == patch_encoding::decimal))
+    struct patch final {
+        static constexpr auto offset = Offset;
+        static constexpr auto width = Width;
+        static constexpr auto encoding = Encoding;
+    };
+
+    namespace uninttp_internals {
+        template <typename T>
+        struct is_patch final : std::false_type {};
+
+        template <std::size_t Offset, std::size_t Width, patch_encoding Encoding>
+        struct is_patch<patch<Offset, Width, Encoding>> final : std::true_type {};
+
+        /* Stores the low `Width` bytes of `v` in the byte order `Order` */
+        template <std::size_t Width, std::endian Order>
+        void mt_store(std::byte* const p, const std::uint64_t v) noexcept {
+            if constexpr (Width == 1)
+                *p = static_cast<std::byte>(v);
+            else if constexpr (Width == 2 || Width == 4 || Width == 8) {
+                auto u = static_cast<bl_uint<Width>>(v);
+                if constexpr (Order != std::endian::native)
+                    u = bl_byteswap(u);
+                std::memcpy(p, &u, Width);
+            } else {
+                auto u = v;
+                if constexpr (Order != std::endian::native)
+                    u = bl_byteswap(u);
+                std::memcpy(p, reinterpret_cast<const std::byte*>(&u) + (Order == std::endian::big ? 8 - Width : 0), Width);
+            }
+        }
+
+        template <typename Patch, typename T>
+        bool mt_write(std::byte* const p, const T& value) noexcept {
+            constexpr auto width = Patch::width;
+            if constexpr (Patch::encoding == patch_encoding::text) {
+                static_assert(std::is_convertible_v<const T&, std::string_view>, "message_template: text patches take strings");
+                const std::string_view s = value;
+                if (s.size() > width)
+                    return false;
+                std::memcpy(p, s.data(), s.size());
+                std::memset(p + s.size(), ' ', width - s.size());
+                return true;
+            } else if constexpr (std::is_enum_v<T>)
+                return mt_write<Patch>(p, static_cast<std::underlying_type_t<T>>(value));
+            else {
+                static_assert(std::is_integral_v<T>, "message_template: integer patches take integers or enumerations");
+                if constexpr (Patch::encoding == patch_encoding::decimal) {
+                    if constexpr (std::is_signed_v<T>)
+                        if (value < 0)
+                            return false;
+                    auto v = static_cast<std::uint64_t>(value);
+                    for (auto i = width; i-- > 0; v /= 10)
+                        p[i] = static_cast<std::byte>('0' + v % 10);
+                    return v == 0;
+                } else {
+                    const auto v = static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+                    if constexpr (width < 8) {
+                        // Values must fit into the slot, either as unsigned or (for signed types) as two's-complement integers
+                        constexpr auto bits = 8 * width;
+                        const auto fits = std::is_signed_v<T> ? (static_cast<std::int64_t>(v) >> (bits - 1)) == 0 || (static_cast<std::int64_t>(v) >> (bits - 1)) == -1
+                                                              : v >> bits == 0;
+                        if (!fits)
+                            return false;
+                    }
+                    mt_store<width, Patch::encoding == patch_encoding::big_endian ? std::endian::big : std::endian::little>(p, v);
+                    return true;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief A message whose constant bytes are laid out at compile time, with slots for the values that change from one message to the next.
+     *
+     * Building a message takes a single `std::memcpy()` of the template followed by a store per slot.
+     *
+     * @tparam Bytes The `uni_auto` array holding the constant bytes; a string literal's null terminator is left out
+     * @tparam Patches The `patch`es describing the slots
+     */
+    template <uni_auto Bytes, typename... Patches>
+        requires (std::is_array_v<std::remove_reference_t<uni_auto_t<Bytes>>> && sizeof(std::remove_extent_t<std::remove_reference_t<uni_auto_t<Bytes>>>) == 1
+                  && (uninttp_internals::is_patch<Patches>::value && ...))
+    struct message_template final {
+        /**
+         * @brief The type of the bytes of the message.
+         */
+        using value_type = std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<uni_auto_t<Bytes>>>>;
+
+        /**
+         * @brief The number of bytes in the message.
+         */
+        static constexpr std::size_t size = [] {
+            if constexpr (std::is_same_v<value_type, char>)
+                return uni_auto_sv<Bytes>.size();
+            else
+                return Bytes.size();
+        }();
+
+    private:
+        static_assert(((Patches::offset + Patches::width <= size) && ...), "message_template: a patch lies outside of the message");
+        static_assert([] {
+            std::array<std::pair<std::size_t, std::size_t>, sizeof...(Patches)> slots { std::pair { Patches::offset, Patches::width }... };
+            std::sort(slots.begin(), slots.end());
+            for (std::size_t i = 1; i < slots.size(); i++)
+                if (slots[i - 1].first + slots[i - 1].second > slots[i].first)
+                    return false;
+            return true;
+        }(), "message_template: patches must not overlap");
+
+        static constexpr auto bytes = [] {
+            std::array<value_type, size> out{};
+            std::copy_n(Bytes.data(), size, out.begin());
+            return out;
+        }();
+
+    public:
+        /**
+         * @brief Writes the values into their slots of the message at `out`, which must already hold the template (e.g., from `build()`).
+         * @return Whether every value fit into its slot (if not, the contents of the slots are unspecified)
+         */
+        template <typename... Values>
+            requires (sizeof...(Values) == sizeof...(Patches))
+        static bool fill(value_type* const out, const Values&... values) noexcept {
+            const auto p = reinterpret_cast<std::byte*>(out);
+            return (uninttp_internals::mt_write<Patches>(p + Patches::offset, values) & ...);
+        }
+
+        /**
+         * @brief Copies the template to `out`, which must hold at least `size` bytes, and writes the values into their slots.
+         * @return Whether every value fit into its slot (if not, the contents of the slots are unspecified)
+         */
+        template <typename... Values>
+            requires (sizeof...(Values) == sizeof...(Patches))
+        static bool build(value_type* const out, const Values&... values) noexcept {
+            std::memcpy(out, bytes.data(), size);
+            return fill(out, values...);
+        }
+    };
+}
+
+#endif /* UNINTTP_MESSAGE_TEMPLATE_HPP */
@@ -0,0 +1,271 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_MULTI_MATCHER_HPP
+#define UNINTTP_MULTI_MATCHER_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        inline constexpr auto ac_npos = static_cast<std::size_t>(-1);
+
+        /* Maps every byte to an equivalence class; bytes that don't occur in any pattern all share class 0 */
+        struct ac_alphabet final {
+            std::array<std::uint16_t, 256> classes{};
+            std::size_t count = 1;
+        };
+
+        template <std::size_t K>
+        constexpr auto ac_make_alphabet(const std::array<std::string_view, K>& patterns) noexcept {
+            ac_alphabet a{};
+            for (const auto& p : patterns)
+                for (const auto c : p) {
+                    auto& cls = a.classes[static_cast<unsigned char>(c)];
+                    if (cls == 0)
+                        cls = static_cast<std::uint16_t>(a.count++);
+                }
+            return a;
+        }
+
+        template <std::size_t K>
+        constexpr auto ac_total_length(const std::array<std::string_view, K>& patterns) noexcept {
+            std::size_t n = 0;
+            for (const auto& p : patterns)
+                n += p.size();
+            return n;
+        }
+
+        /* The goto/failure closure of the trie, i.e., the complete DFA, before the states get renumbered */
+        template <std::size_t K, std::size_t Classes, std::size_t MaxStates>
+        struct ac_automaton final {
+            std::size_t states = 1;
+            std::array<std::array<std::size_t, Classes>, MaxStates> delta{};
+            std::array<std::size_t, MaxStates> own{};  // First pattern ending exactly at the state
+            std::array<std::size_t, MaxStates> dict{}; // Nearest state along the failure chain that has patterns of its own
+            std::array<std::size_t, K> next_same{};    // Next pattern with an identical spelling
+        };
+
+        template <std::size_t Classes, std::size_t MaxStates, std::size_t K>
+        constexpr auto ac_build(const std::array<std::string_view, K>& patterns, const ac_alphabet& alphabet) noexcept {
+            ac_automaton<K, Classes, MaxStates> a{};
+            a.own.fill(ac_npos);
+            a.dict.fill(ac_npos);
+            a.next_same.fill(ac_npos);
+
+            // The root is never a child, so `0` doubles as "no edge" while the trie is being built
+            for (std::size_t k = 0; k < K; k++) {
+                std::size_t s = 0;
+                for (const auto c : patterns[k]) {
+                    auto& next = a.delta[s][alphabet.classes[static_cast<unsigned char>(c)]];
+                    if (next == 0)
+                        next = a.states++;
+                    s = next;
+                }
+                if (a.own[s] == ac_npos)
+                    a.own[s] = k;
+                else {
+                    auto t = a.own[s];
+                    while (a.next_same[t] != ac_npos)
+                        t = a.next_same[t];
+                    a.next_same[t] = k;
+                }
+            }
+
+            std::array<std::size_t, MaxStates> fail{}, queue{};
+            std::size_t head = 0, tail = 0;
+            for (std::size_t c = 0; c < Classes; c++)
+                if (const auto u = a.delta[0][c]; u != 0)
+                    queue[tail++] = u;
+            while (head < tail) {
+                const auto r = queue[head++];
+                for (std::size_t c = 0; c < Classes; c++) {
+                    const auto u = a.delta[r][c];
+                    if (u == 0) {
+                        a.delta[r][c] = a.delta[fail[r]][c];
+                        continue;
+                    }
+                    fail[u] = a.delta[fail[r]][c];
+                    a.dict[u] = a.own[fail[u]] != ac_npos ? fail[u] : a.dict[fail[u]];
+                    queue[tail++] = u;
+                }
+            }
+            return a;
+        }
+
+        template <std::size_t States, std::size_t Classes>
+        using ac_row_t = std::conditional_t<(States * Classes <= 0xFFFF), std::uint16_t, std::uint32_t>;
+
+        /* The final, compressed tables: states that report matches are numbered last, and transitions hold premultiplied row offsets */
+        template <std::size_t K, std::size_t Classes, std::size_t States>
+        struct ac_tables final {
+            std::array<std::uint16_t, 256> classes{};
+            std::array<ac_row_t<States, Classes>, States * Classes> delta{};
+            std::array<std::size_t, States> own{};
+            std::array<std::size_t, States> dict{};
+            std::array<std::size_t, K> next_same{};
+            std::size_t accepting_row = 0;
+        };
+
+        template <std::size_t States, std::size_t K, std::size_t Classes, std::size_t MaxStates>
+        constexpr auto ac_compress(const ac_automaton<K, Classes, MaxStates>& a, const ac_alphabet& alphabet) noexcept {
+            ac_tables<K, Classes, States> t{};
+            t.classes = alphabet.classes;
+            t.next_same = a.next_same;
+
+            std::array<std::size_t, States> renumber{};
+            std::size_t n = 0;
+            for (std::size_t s = 0; s < States; s++)
+                if (a.own[s] == ac_npos && a.dict[s] == ac_npos)
+                    renumber[s] = n++;
+            t.accepting_row = n * Classes;
+            for (std::size_t s = 0; s < States; s++)
+                if (a.own[s] != ac_npos || a.dict[s] != ac_npos)
+                    renumber[s] = n++;
+
+            for (std::size_t s = 0; s < States; s++) {
+                const auto r = renumber[s];
+                for (std::size_t c = 0; c < Classes; c++)
+                    t.delta[r * Classes + c] = static_cast<ac_row_t<States, Classes>>(renumber[a.delta[s][c]] * Classes);
+                t.own[r] = a.own[s];
+                t.dict[r] = a.dict[s] == ac_npos ? ac_npos : renumber[a.dict[s]];
+            }
+            return t;
+        }
+    }
+
+    /**
+     * @brief A streaming Aho-Corasick matcher whose DFA gets compiled from a pack of string literals at compile time.
+     * @tparam Patterns The (non-empty) `uni_auto` strings to search for
+     */
+    template <uni_auto... Patterns>
+        requires (sizeof...(Patterns) > 0 && (std::is_same_v<typename decltype(uni_auto_sv<Patterns>)::value_type, char> && ...))
+    struct multi_matcher final {
+    private:
+        static constexpr std::array<std::string_view, sizeof...(Patterns)> patterns { uni_auto_sv<Patterns>... };
+
+        static_assert(((uni_auto_sv<Patterns>.size() > 0) && ...), "multi_matcher: patterns cannot be empty");
+
+        static constexpr auto alphabet = uninttp_internals::ac_make_alphabet(patterns);
+        static constexpr auto automaton = uninttp_internals::ac_build<alphabet.count, uninttp_internals::ac_total_length(patterns) + 1>(patterns, alphabet);
+        static constexpr auto tables = uninttp_internals::ac_compress<automaton.states>(automaton, alphabet);
+
+        std::size_t row = 0;
+        std::size_t consumed = 0;
+
+        template <typename F>
+        constexpr auto report(const std::size_t end, F& on_match) const {
+            for (auto s = row / alphabet.count; s != uninttp_internals::ac_npos; s = tables.dict[s])
+                for (auto p = tables.own[s]; p != uninttp_internals::ac_npos; p = tables.next_same[p]) {
+                    if constexpr (std::is_same_v<std::invoke_result_t<F&, std::size_t, std::size_t>, bool>) {
+                        if (!std::invoke(on_match, p, end - patterns[p].size()))
+                            return false;
+                    } else
+                        std::invoke(on_match, p, end - patterns[p].size());
+                }
+            return true;
+        }
+
+    public:
+        /**
+         * @brief Gives the number of patterns.
+         */
+        static constexpr auto size() noexcept {
+            return sizeof...(Patterns);
+        }
+
+        /**
+         * @brief Gives the number of states in the underlying DFA.
+         */
+        static constexpr auto state_count() noexcept {
+            return automaton.states;
+        }
+
+        /**
+         * @brief Gives the pattern with the index `i`.
+         */
+        static constexpr auto pattern(const std::size_t i) noexcept {
+            return patterns[i];
+        }
+
+        /**
+         * @brief Gives the total number of bytes fed so far.
+         */
+        constexpr auto offset() const noexcept {
+            return consumed;
+        }
+
+        /**
+         * @brief Forgets any partial match and restarts the offsets from zero.
+         */
+        constexpr auto reset() noexcept {
+            row = 0;
+            consumed = 0;
+        }
+
+        /**
+         * @brief Scans the next chunk of the stream, carrying partial matches over from the previous chunks.
+         * @param on_match Invoked as `on_match(pattern_index, offset)` for every match, where `offset` is the position of the first byte of
+         *                 the match in the whole stream (and thus may lie in an earlier chunk); returning `false` from it stops the scan
+         * @return `false` if the scan was stopped by `on_match`, `true` otherwise
+         */
+        template <typename F>
+            requires std::is_invocable_v<F&, std::size_t, std::size_t>
+        constexpr auto feed(const std::string_view chunk, F&& on_match) {
+            auto r = row;
+            for (std::size_t i = 0; i < chunk.size(); i++) {
+                r = tables.delta[r + tables.classes[static_cast<unsigned char>(chunk[i])]];
+                if (r >= tables.accepting_row) [[unlikely]] {
+                    row = r;
+                    if (!report(consumed + i + 1, on_match)) {
+                        consumed += i + 1;
+                        return false;
+                    }
+                }
+            }
+            row = r;
+            consumed += chunk.size();
+            return true;
+        }
+    };
+}
+
+#endif /* UNINTTP_MULTI_MATCHER_HPP */
@@ -0,0 +1,230 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_PACKET_PARSER_HPP
+#define UNINTTP_PACKET_PARSER_HPP
+
+#include "uni_auto.hpp"
+#include "field.hpp"
+#include "binary_layout.hpp"
+#include <type_traits>
+#include <algorithm>
+#include <string_view>
+#include <optional>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <tuple>
+#include <bit>
+
+namespace uninttp {
+    /**
+     * @brief Describes where a data member is found within a fixed-layout binary message.
+     *
+     * Integers (and enumerations and `bool`s) may be narrower on the wire than in the class, e.g. 6-byte timestamps; signed ones get
+     * sign-extended. Floating-point members must be exactly as wide as their type; arrays are copied as they are.
+     *
+     * @tparam Offset The offset of the value within the message, in bytes
+     * @tparam Width The width of the value within the message, in bytes
+     * @tparam Order The byte order of the value
+     * @tparam Member The `uni_auto` pointer to the data member
+     */
+    template <std::size_t Offset, std::size_t Width, std::endian Order, uni_auto Member>
+        requires (Width > 0 && std::is_member_object_pointer_v<uni_auto_simplify_t<Member>>)
+    struct packet_field final {
+        using class_type = typename field<Offset, Member>::class_type;
+        using value_type = typename field<Offset, Member>::value_type;
+
+        static constexpr auto offset = Offset;
+        static constexpr auto width = Width;
+        static constexpr auto order = Order;
+        static constexpr auto member = uni_auto_simplify_v<Member>;
+
+        static_assert(std::is_trivially_copyable_v<value_type>, "packet_field: members must be trivially copyable");
+        static_assert(!(std::is_integral_v<value_type> || std::is_enum_v<value_type>) || Width <= sizeof(value_type), "packet_field: the value is wider than its member");
+        static_assert(std::is_integral_v<value_type> || std::is_enum_v<value_type> || Width == sizeof(value_type), "packet_field: the value must be exactly as wide as its member");
+        static_assert(!std::is_floating_point_v<value_type> || sizeof(value_type) == 4 || sizeof(value_type) == 8, "packet_field: floating-point members must be 32 or 64 bits wide");
+    };
+
+    namespace uninttp_internals {
+        template <typename T>
+        struct is_packet_field final : std::false_type {};
+
+        template <std::size_t Offset, std::size_t Width, std::endian Order, uni_auto Member>
+        struct is_packet_field<packet_field<Offset, Width, Order, Member>> final : std::true_type {};
+
+        /* Loads an unsigned integer of `Width` bytes, stored in the byte order `Order`, from a possibly unaligned address */
+        template <std::size_t Width, std::endian Order>
+        std::uint64_t pp_load(const std::byte* const p) noexcept {
+            if constexpr (Width == 1)
+                return std::to_integer<std::uint64_t>(*p);
+            else if constexpr (Width == 2 || Width == 4 || Width == 8) {
+                bl_uint<Width> v;
+                std::memcpy(&v, p, Width);
+                return Order == std::endian::native ? v : bl_byteswap(v);
+            } else {
+                std::uint64_t v = 0;
+                std::memcpy(reinterpret_cast<std::byte*>(&v) + (Order == std::endian::big ? 8 - Width : 0), p, Width);
+                if constexpr (Order != std::endian::native)
+                    v = bl_byteswap(v);
+                return v;
+            }
+        }
+
+        template <typename T, std::size_t Width, std::endian Order>
+        void pp_decode(const std::byte* const p, T& out) noexcept {
+            if constexpr (std::is_same_v<T, bool>)
+                out = pp_load<Width, Order>(p) != 0;
+            else if constexpr (std::is_enum_v<T>) {
+                std::underlying_type_t<T> v;
+                pp_decode<std::underlying_type_t<T>, Width, Order>(p, v);
+                out = static_cast<T>(v);
+            } else if constexpr (std::is_integral_v<T>) {
+                auto v = pp_load<Width, Order>(p);
+                if constexpr (std::is_signed_v<T> && Width < 8)
+                    v = static_cast<std::uint64_t>(static_cast<std::int64_t>(v << (64 - 8 * Width)) >> (64 - 8 * Width));
+                out = static_cast<T>(v);
+            } else if constexpr (std::is_floating_point_v<T>)
+                out = std::bit_cast<T>(static_cast<bl_uint<sizeof(T)>>(pp_load<Width, Order>(p)));
+            else
+                std::memcpy(&out, p, sizeof(T));
+        }
+
+        template <typename Field>
+        void pp_decode(const std::byte* const data, typename Field::class_type& out) noexcept {
+            pp_decode<typename Field::value_type, Field::width, Field::order>(data + Field::offset, out.*Field::member);
+        }
+    }
+
+    /**
+     * @brief A parser for fixed-layout binary messages, generated from where each member is found.
+     *
+     * The length of a message is checked once; after that, every field is read with an unaligned load and, where needed, a byte swap.
+     *
+     * @tparam Fields The `packet_field`s making up the message
+     */
+    template <typename... Fields>
+        requires (sizeof...(Fields) > 0 && (uninttp_internals::is_packet_field<Fields>::value && ...))
+    struct packet_parser final {
+    private:
+        using class_type = fields_class_t<field<Fields::offset, Fields::member>...>;
+
+        template <std::size_t Index>
+        using field_at = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+        template <auto Member, typename Field>
+        static constexpr auto describes() noexcept {
+            if constexpr (std::is_same_v<decltype(Member), std::remove_cv_t<decltype(Field::member)>>)
+                return Member == Field::member;
+            else
+                return false;
+        }
+
+        template <uni_auto Member>
+        static constexpr auto index_of = [] {
+            std::size_t i = 0, found = sizeof...(Fields);
+            ((found = found == sizeof...(Fields) && describes<uni_auto_simplify_v<Member>, Fields>() ? i : found, i++), ...);
+            return found;
+        }();
+
+    public:
+        /**
+         * @brief The number of bytes that a message takes up, i.e., the end of its furthest field.
+         */
+        static constexpr std::size_t size = std::max({ (Fields::offset + Fields::width)... });
+
+        /**
+         * @brief Refers to a message without copying it, decoding fields only when they get accessed.
+         */
+        struct view final {
+        private:
+            const std::byte* bytes;
+
+        public:
+            /**
+             * @brief Wraps the message at `data`, which must hold at least `size` bytes.
+             */
+            explicit constexpr view(const std::byte* const data) noexcept : bytes{ data } {}
+
+            /**
+             * @brief Returns the message that the view refers to.
+             */
+            constexpr auto data() const noexcept {
+                return bytes;
+            }
+
+            /**
+             * @brief Decodes the field for the data member pointed to by `Member`; `char` arrays are given as `std::string_view`s into the message.
+             */
+            template <uni_auto Member>
+                requires (index_of<Member> < sizeof...(Fields))
+            auto get() const noexcept {
+                using Field = field_at<index_of<Member>>;
+                using T = typename Field::value_type;
+                if constexpr (std::is_array_v<T>) {
+                    static_assert(std::is_same_v<std::remove_extent_t<T>, char>, "packet_parser::view: only char arrays can be accessed through a view");
+                    return std::string_view { reinterpret_cast<const char*>(bytes + Field::offset), Field::width };
+                } else {
+                    T out;
+                    uninttp_internals::pp_decode<T, Field::width, Field::order>(bytes + Field::offset, out);
+                    return out;
+                }
+            }
+        };
+
+        /**
+         * @brief Returns a view of the message in `[first, last)`, or `std::nullopt` if it's too short.
+         */
+        static std::optional<view> view_of(const std::byte* const first, const std::byte* const last) noexcept {
+            if (static_cast<std::size_t>(last - first) < size)
+                return std::nullopt;
+            return view { first };
+        }
+
+        /**
+         * @brief Decodes every field of the message in `[first, last)` into `out`.
+         * @return Whether the message was long enough
+         */
+        static bool parse(const std::byte* const first, const std::byte* const last, class_type& out) noexcept {
+            if (static_cast<std::size_t>(last - first) < size)
+                return false;
+            (uninttp_internals::pp_decode<Fields>(first, out), ...);
+            return true;
+        }
+    };
+}
+
+#endif /* UNINTTP_PACKET_PARSER_HPP */
@@ -0,0 +1,744 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_REGEX_HPP
+#define UNINTTP_REGEX_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        inline constexpr auto re_npos = static_cast<std::size_t>(-1);
+
+        struct re_charset final {
+            std::array<std::uint64_t, 4> bits{};
+
+            constexpr auto set(const unsigned char c) noexcept {
+                bits[c >> 6] |= std::uint64_t{ 1 } << (c & 63);
+            }
+
+            constexpr auto set_range(const unsigned char lo, const unsigned char hi) noexcept {
+                for (auto c = static_cast<unsigned>(lo); c <= hi; c++)
+                    set(static_cast<unsigned char>(c));
+            }
+
+            constexpr auto merge(const re_charset& other) noexcept {
+                for (std::size_t i = 0; i < bits.size(); i++)
+                    bits[i] |= other.bits[i];
+            }
+
+            constexpr auto invert() noexcept {
+                for (auto& word : bits)
+                    word = ~word;
+            }
+
+            constexpr bool test(const unsigned char c) const noexcept {
+                return (bits[c >> 6] >> (c & 63)) & 1;
+            }
+        };
+
+        enum class re_node_kind : unsigned char { empty, set, cat, alt, repeat, group };
+
+        struct re_node final {
+            re_node_kind kind = re_node_kind::empty;
+            re_charset set{};
+            std::size_t a = 0, b = 0;
+            std::size_t min = 0, max = 0;
+            std::size_t group = 0;
+        };
+
+        /* A recursive-descent parser for the supported (ECMAScript-like) subset of the regular expression syntax */
+        struct re_parser final {
+            std::string_view pattern;
+            std::size_t i = 0;
+            std::size_t groups = 0;
+            std::size_t depth = 0; // How many groups the parser is inside of
+            bool alternated = false; // Whether a `|` appears outside of every group
+            std::vector<re_node> nodes;
+
+            constexpr bool done() const noexcept {
+                return i == pattern.size();
+            }
+
+            constexpr auto peek() const noexcept {
+                return pattern[i];
+            }
+
+            constexpr auto add(const re_node& n) {
+                nodes.push_back(n);
+                return nodes.size() - 1;
+            }
+
+            static constexpr auto hex_digit(const char c) noexcept -> int {
+                if (c >= '0' && c <= '9') return c - '0';
+                if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+                return -1;
+            }
+
+            /* Parses the character after a backslash; gives the escaped character, or -1 if it named a whole class (which gets merged into `out`) */
+            constexpr auto escape(re_charset& out) -> int {
+                if (done()) {
+                    compile_time_error("trailing backslash");
+                    return -1;
+                }
+                const auto c = pattern[i++];
+                re_charset cls{};
+                switch (c) {
+                    case 'd': case 'D':
+                        cls.set_range('0', '9');
+                        break;
+                    case 'w': case 'W':
+                        cls.set_range('a', 'z');
+                        cls.set_range('A', 'Z');
+                        cls.set_range('0', '9');
+                        cls.set('_');
+                        break;
+                    case 's': case 'S':
+                        for (const auto ws : std::string_view(" \t\n\r\f\v"))
+                            cls.set(static_cast<unsigned char>(ws));
+                        break;
+                    case 'n': return '\n';
+                    case 't': return '\t';
+                    case 'r': return '\r';
+                    case 'f': return '\f';
+                    case 'v': return '\v';
+                    case '0': return '\0';
+                    case 'x': {
+                        if (pattern.size() - i < 2 || hex_digit(pattern[i]) < 0 || hex_digit(pattern[i + 1]) < 0) {
+                            compile_time_error("\\x must be followed by two hexadecimal digits");
+                            return -1;
+                        }
+                        const auto v = hex_digit(pattern[i]) * 16 + hex_digit(pattern[i + 1]);
+                        i += 2;
+                        return v;
+                    }
+                    default:
+                        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                            compile_time_error("unsupported escape sequence");
+                            return -1;
+                        }
+                        return static_cast<unsigned char>(c);
+                }
+                if (c >= 'A' && c <= 'Z')
+                    cls.invert();
+                out.merge(cls);
+                return -1;
+            }
+
+            constexpr auto bracket() {
+                re_node n{ .kind = re_node_kind::set };
+                const auto negate = !done() && peek() == '^';
+                if (negate)
+                    i++;
+                for (auto first = true;; first = false) {
+                    if (done()) {
+                        compile_time_error("unterminated character class");
+                        break;
+                    }
+                    if (peek() == ']' && !first) {
+                        i++;
+                        break;
+                    }
+                    int lo = static_cast<unsigned char>(pattern[i++]);
+                    if (lo == '\\' && (lo = escape(n.set)) < 0)
+                        continue;
+                    if (pattern.size() - i >= 2 && peek() == '-' && pattern[i + 1] != ']') {
+                        i++;
+                        int hi = static_cast<unsigned char>(pattern[i++]);
+                        re_charset unused{};
+                        if (hi == '\\' && (hi = escape(unused)) < 0)
+                            compile_time_error("a character class cannot be the end of a range");
+                        else if (hi < lo)
+                            compile_time_error("character range is out of order");
+                        else
+                            n.set.set_range(static_cast<unsigned char>(lo), static_cast<unsigned char>(hi));
+                    } else
+                        n.set.set(static_cast<unsigned char>(lo));
+                }
+                if (negate)
+                    n.set.invert();
+                return add(n);
+            }
+
+            constexpr auto number() {
+                std::size_t n = 0;
+                if (done() || peek() < '0' || peek() > '9')
+                    compile_time_error("expected a number inside {}");
+                while (!done() && peek() >= '0' && peek() <= '9')
+                    n = n * 10 + static_cast<std::size_t>(pattern[i++] - '0');
+                return n;
+            }
+
+            constexpr std::size_t atom() {
+                const auto c = pattern[i++];
+                switch (c) {
+                    case '(': {
+                        auto capture = true;
+                        if (!done() && peek() == '?') {
+                            if (pattern.substr(i, 2) != "?:")
+                                compile_time_error("only non-capturing groups are supported as (? groups");
+                            i += 2;
+                            capture = false;
+                        }
+                        const auto g = capture ? ++groups : 0;
+                        depth++;
+                        const auto inner = alternation();
+                        depth--;
+                        if (done() || peek() != ')')
+                            compile_time_error("missing )");
+                        else
+                            i++;
+                        return capture ? add({ .kind = re_node_kind::group, .a = inner, .group = g }) : inner;
+                    }
+                    case '[':
+                        return bracket();
+                    case '.': {
+                        re_node n{ .kind = re_node_kind::set };
+                        n.set.set('\n');
+                        n.set.invert();
+                        return add(n);
+                    }
+                    case '\\': {
+                        re_node n{ .kind = re_node_kind::set };
+                        if (const auto v = escape(n.set); v >= 0)
+                            n.set.set(static_cast<unsigned char>(v));
+                        return add(n);
+                    }
+                    case '*': case '+': case '?': case '{':
+                        compile_time_error("nothing to repeat");
+                        return add({});
+                    case '^': case '$':
+                        compile_time_error("anchors are only supported at the very beginning and the very end of a pattern");
+                        return add({});
+                    default: {
+                        re_node n{ .kind = re_node_kind::set };
+                        n.set.set(static_cast<unsigned char>(c));
+                        return add(n);
+                    }
+                }
+            }
+
+            constexpr std::size_t repetition() {
+                auto n = atom();
+                while (!done()) {
+                    std::size_t min = 0, max = re_npos;
+                    switch (peek()) {
+                        case '*': i++; break;
+                        case '+': i++; min = 1; break;
+                        case '?': i++; max = 1; break;
+                        case '{':
+                            i++;
+                            min = max = number();
+                            if (!done() && peek() == ',') {
+                                i++;
+                                max = !done() && peek() == '}' ? re_npos : number();
+                            }
+                            if (done() || peek() != '}')
+                                compile_time_error("missing }");
+                            else
+                                i++;
+                            if (max < min)
+                                compile_time_error("numbers out of order in {} quantifier");
+                            break;
+                        default:
+                            return n;
+                    }
+                    if (!done() && peek() == '?')
+                        compile_time_error("lazy quantifiers are not supported");
+                    n = add({ .kind = re_node_kind::repeat, .a = n, .min = min, .max = max });
+                }
+                return n;
+            }
+
+            constexpr std::size_t concatenation() {
+                auto n = re_npos;
+                while (!done() && peek() != '|' && peek() != ')') {
+                    const auto r = repetition();
+                    n = n == re_npos ? r : add({ .kind = re_node_kind::cat, .a = n, .b = r });
+                }
+                return n == re_npos ? add({}) : n;
+            }
+
+            constexpr std::size_t alternation() {
+                auto n = concatenation();
+                while (!done() && peek() == '|') {
+                    i++;
+                    alternated |= depth == 0;
+                    n = add({ .kind = re_node_kind::alt, .a = n, .b = concatenation() });
+                }
+                return n;
+            }
+        };
+
+        enum class re_op : unsigned char { set, split, save, match };
+
+        /* An instruction of the Thompson NFA (the `split` instruction prefers `out` over `out1`, and the `slot` of a `match` instruction tells which pattern matched) */
+        struct re_inst final {
+            re_op op = re_op::match;
+            re_charset set{};
+            std::size_t out = 0, out1 = 0;
+            std::size_t slot = 0;
+        };
+
+        struct re_program final {
+            std::vector<re_inst> insts;
+            std::size_t start = 0;
+            std::size_t groups = 0;
+            bool anchored_begin = false;
+            bool anchored_end = false;
+        };
+
+        /* Emits the instructions for `node` backwards, i.e., given the instruction that follows it */
+        constexpr std::size_t re_emit(const std::vector<re_node>& nodes, std::vector<re_inst>& insts, const std::size_t node, const std::size_t next) {
+            const auto push = [&](const re_inst& inst) {
+                insts.push_back(inst);
+                return insts.size() - 1;
+            };
+            const auto& n = nodes[node];
+            switch (n.kind) {
+                case re_node_kind::empty:
+                    return next;
+                case re_node_kind::set:
+                    return push({ .op = re_op::set, .set = n.set, .out = next });
+                case re_node_kind::cat:
+                    return re_emit(nodes, insts, n.a, re_emit(nodes, insts, n.b, next));
+                case re_node_kind::alt: {
+                    const auto a = re_emit(nodes, insts, n.a, next);
+                    return push({ .op = re_op::split, .out = a, .out1 = re_emit(nodes, insts, n.b, next) });
+                }
+                case re_node_kind::group: {
+                    const auto close = push({ .op = re_op::save, .out = next, .slot = 2 * n.group + 1 });
+                    return push({ .op = re_op::save, .out = re_emit(nodes, insts, n.a, close), .slot = 2 * n.group });
+                }
+                case re_node_kind::repeat: {
+                    auto tail = next;
+                    if (n.max == re_npos) {
+                        tail = push({ .op = re_op::split, .out1 = next });
+                        const auto body = re_emit(nodes, insts, n.a, tail);
+                        insts[tail].out = body;
+                    } else
+                        for (auto k = n.min; k < n.max; k++)
+                            tail = push({ .op = re_op::split, .out = re_emit(nodes, insts, n.a, tail), .out1 = next });
+                    for (std::size_t k = 0; k < n.min; k++)
+                        tail = re_emit(nodes, insts, n.a, tail);
+                    return tail;
+                }
+            }
+            return next;
+        }
+
+        constexpr auto re_compile(std::string_view pattern) {
+            re_program prog{};
+            if (pattern.starts_with('^')) {
+                prog.anchored_begin = true;
+                pattern.remove_prefix(1);
+            }
+            if (pattern.ends_with('$')) {
+                std::size_t backslashes = 0;
+                for (auto k = pattern.size() - 1; k > 0 && pattern[k - 1] == '\\'; k--)
+                    backslashes++;
+                if (backslashes % 2 == 0) {
+                    prog.anchored_end = true;
+                    pattern.remove_suffix(1);
+                }
+            }
+            re_parser parser{};
+            parser.pattern = pattern;
+            const auto root = parser.alternation();
+            if (!parser.done())
+                compile_time_error("unbalanced )");
+            if ((prog.anchored_begin || prog.anchored_end) && parser.alternated)
+                compile_time_error("an anchor can't stand next to a | outside of a group (write ^(?:a|b)$ to anchor every alternative)");
+            prog.groups = parser.groups;
+            const auto match = prog.insts.size();
+            prog.insts.push_back({ .op = re_op::match });
+            const auto close = prog.insts.size();
+            prog.insts.push_back({ .op = re_op::save, .out = match, .slot = 1 });
+            const auto body = re_emit(parser.nodes, prog.insts, root, close);
+            prog.start = prog.insts.size();
+            prog.insts.push_back({ .op = re_op::save, .out = body, .slot = 0 });
+            return prog;
+        }
+
+        /* Follows `split` and `save` instructions; gives the sorted `set`/`match` instructions reachable from `seeds` */
+        template <std::size_t N>
+        constexpr auto re_closure(const std::array<re_inst, N>& insts, std::vector<std::size_t> stack) {
+            std::vector<bool> seen(N);
+            std::vector<std::size_t> result;
+            while (!stack.empty()) {
+                const auto pc = stack.back();
+                stack.pop_back();
+                if (seen[pc])
+                    continue;
+                seen[pc] = true;
+                switch (insts[pc].op) {
+                    case re_op::split:
+                        stack.push_back(insts[pc].out1);
+                        stack.push_back(insts[pc].out);
+                        break;
+                    case re_op::save:
+                        stack.push_back(insts[pc].out);
+                        break;
+                    default:
+                        result.push_back(pc);
+                }
+            }
+            for (std::size_t a = 1; a < result.size(); a++)
+                for (auto b = a; b > 0 && result[b - 1] > result[b]; b--) {
+                    const auto t = result[b];
+                    result[b] = result[b - 1];
+                    result[b - 1] = t;
+                }
+            return result;
+        }
+
+        struct re_dfa final {
+            std::array<std::uint8_t, 256> classes{};
+            std::size_t class_count = 0;
+            std::vector<std::size_t> delta;
+            std::vector<std::size_t> accept; // The lowest `slot` among the `match` instructions of each state (`re_npos` if there are none)
+        };
+
+        /* Subset construction over the byte classes induced by the NFA's character sets; state 0 is the dead state and state 1 is the start state */
+        template <std::size_t N>
+        constexpr auto re_determinize(const std::array<re_inst, N>& insts, const std::size_t start) {
+            re_dfa dfa{};
+            dfa.class_count = 1;
+            for (const auto& inst : insts) {
+                if (inst.op != re_op::set)
+                    continue;
+                std::vector<std::size_t> split(2 * dfa.class_count, re_npos);
+                auto count = std::size_t{ 0 };
+                for (std::size_t c = 0; c < 256; c++) {
+                    auto& id = split[2 * dfa.classes[c] + inst.set.test(static_cast<unsigned char>(c))];
+                    if (id == re_npos)
+                        id = count++;
+                    dfa.classes[c] = static_cast<std::uint8_t>(id);
+                }
+                dfa.class_count = count;
+            }
+            std::array<unsigned char, 256> representative{};
+            for (auto c = std::size_t{ 256 }; c-- > 0;)
+                representative[dfa.classes[c]] = static_cast<unsigned char>(c);
+
+            std::vector<std::vector<std::size_t>> states{ {}, re_closure(insts, { start }) };
+            for (std::size_t s = 0; s < states.size(); s++) {
+                dfa.accept.push_back(re_npos);
+                for (const auto pc : states[s])
+                    if (insts[pc].op == re_op::match && insts[pc].slot < dfa.accept[s])
+                        dfa.accept[s] = insts[pc].slot;
+                for (std::size_t c = 0; c < dfa.class_count; c++) {
+                    std::vector<std::size_t> seeds;
+                    for (const auto pc : states[s])
+                        if (insts[pc].op == re_op::set && insts[pc].set.test(representative[c]))
+                            seeds.push_back(insts[pc].out);
+                    const auto next = re_closure(insts, seeds);
+                    auto id = std::size_t{ 0 };
+                    while (id < states.size() && states[id] != next)
+                        id++;
+                    if (id == states.size())
+                        states.push_back(next);
+                    dfa.delta.push_back(id);
+                }
+            }
+            return dfa;
+        }
+
+        struct re_dfa_shape final {
+            std::size_t states = 0;
+            std::size_t classes = 0;
+        };
+
+        template <std::size_t N>
+        constexpr auto re_shape(const std::array<re_inst, N>& insts, const std::size_t start) {
+            const auto dfa = re_determinize(insts, start);
+            return re_dfa_shape{ dfa.accept.size(), dfa.class_count };
+        }
+
+        template <std::size_t States>
+        using re_state_t = std::conditional_t<(States <= 0xFF), std::uint8_t, std::conditional_t<(States <= 0xFFFF), std::uint16_t, std::uint32_t>>;
+
+        template <std::size_t States, std::size_t Classes>
+        struct re_tables final {
+            std::array<std::uint8_t, 256> classes{};
+            std::array<re_state_t<States>, States * Classes> delta{};
+            std::array<bool, States> accept{};
+            std::array<bool, 256> viable{}; // Bytes that can begin a match
+        };
+
+        template <std::size_t States, std::size_t Classes>
+        constexpr auto re_freeze(const re_dfa& dfa) {
+            re_tables<States, Classes> t{};
+            t.classes = dfa.classes;
+            for (std::size_t k = 0; k < dfa.delta.size(); k++)
+                t.delta[k] = static_cast<re_state_t<States>>(dfa.delta[k]);
+            for (std::size_t s = 0; s < States; s++)
+                t.accept[s] = dfa.accept[s] != re_npos;
+            for (std::size_t c = 0; c < 256; c++)
+                t.viable[c] = t.delta[Classes + t.classes[c]] != 0;
+            return t;
+        }
+
+        template <std::size_t N>
+        struct re_frozen_program final {
+            std::array<re_inst, N> insts{};
+            std::size_t start = 0;
+            std::size_t groups = 0;
+            bool anchored_begin = false;
+            bool anchored_end = false;
+        };
+
+        template <std::size_t N>
+        constexpr auto re_freeze(const re_program& prog) {
+            re_frozen_program<N> p{};
+            for (std::size_t k = 0; k < N; k++)
+                p.insts[k] = prog.insts[k];
+            p.start = prog.start;
+            p.groups = prog.groups;
+            p.anchored_begin = prog.anchored_begin;
+            p.anchored_end = prog.anchored_end;
+            return p;
+        }
+
+        /* The metacharacters, which have to be escaped to stand for themselves */
+        constexpr bool re_is_special(const char c) noexcept {
+            return std::string_view("\\^$.|?*+()[]{}").find(c) != std::string_view::npos;
+        }
+
+        /* `s` with a backslash before each metacharacter, null-terminated; `N` comes from `re_escaped_size()` */
+        template <std::size_t N>
+        constexpr auto re_escape(const std::string_view s) noexcept {
+            std::array<char, N> out{};
+            std::size_t k = 0;
+            for (const auto c : s) {
+                if (re_is_special(c))
+                    out[k++] = '\\';
+                out[k++] = c;
+            }
+            return out;
+        }
+
+        constexpr auto re_escaped_size(const std::string_view s) noexcept {
+            auto n = s.size() + 1;
+            for (const auto c : s)
+                n += re_is_special(c);
+            return n;
+        }
+
+        /* A Pike VM over the NFA, used for extracting the submatches of a full match */
+        template <std::size_t N, std::size_t Slots>
+        struct re_vm final {
+            using captures = std::array<std::size_t, Slots>;
+
+            struct thread_list final {
+                std::array<std::size_t, N> pcs{};
+                std::array<captures, N> caps{};
+                std::size_t size = 0;
+            };
+
+            const std::array<re_inst, N>& insts;
+            std::array<std::size_t, N> marks{};
+            std::size_t generation = 0;
+
+            constexpr re_vm(const std::array<re_inst, N>& program) noexcept : insts{ program } {}
+
+            constexpr void add(thread_list& list, const std::size_t pc, const captures& caps, const std::size_t pos) {
+                if (marks[pc] == generation)
+                    return;
+                marks[pc] = generation;
+                const auto& inst = insts[pc];
+                switch (inst.op) {
+                    case re_op::split:
+                        add(list, inst.out, caps, pos);
+                        add(list, inst.out1, caps, pos);
+                        break;
+                    case re_op::save: {
+                        auto next = caps;
+                        next[inst.slot] = pos;
+                        add(list, inst.out, next, pos);
+                        break;
+                    }
+                    default:
+                        list.pcs[list.size] = pc;
+                        list.caps[list.size++] = caps;
+                }
+            }
+
+            constexpr auto run(const std::size_t start, const std::string_view s) -> std::optional<captures> {
+                thread_list lists[2]{};
+                auto* cur = &lists[0];
+                auto* next = &lists[1];
+                captures none{};
+                none.fill(re_npos);
+                generation = 1;
+                add(*cur, start, none, 0);
+                for (std::size_t i = 0; i < s.size() && cur->size > 0; i++) {
+                    generation++;
+                    next->size = 0;
+                    for (std::size_t t = 0; t < cur->size; t++) {
+                        const auto& inst = insts[cur->pcs[t]];
+                        if (inst.op == re_op::set && inst.set.test(static_cast<unsigned char>(s[i])))
+                            add(*next, inst.out, cur->caps[t], i + 1);
+                    }
+                    const auto tmp = cur;
+                    cur = next;
+                    next = tmp;
+                }
+                for (std::size_t t = 0; t < cur->size; t++)
+                    if (insts[cur->pcs[t]].op == re_op::match)
+                        return cur->caps[t];
+                return std::nullopt;
+            }
+        };
+    }
+
+    /**
+     * @brief Escapes every metacharacter in a string literal, so that it can be used as a pattern matching that exact text.
+     * @tparam Value The `uni_auto` string to escape
+     */
+    template <uni_auto Value>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Value>)::value_type, char>
+    constexpr auto regex_escaped_v = to_uni_auto(uninttp_internals::re_escape<uninttp_internals::re_escaped_size(uni_auto_sv<Value>)>(uni_auto_sv<Value>));
+
+    /**
+     * @brief A regular expression that gets compiled into a DFA at compile time.
+     *
+     * Supports literals, `.`, bracket expressions, the `\d`, `\w`, `\s` (and negated) classes, the usual character escapes, capturing and
+     * non-capturing groups, alternation, the greedy `*`, `+`, `?` and `{m,n}` quantifiers, and `^`/`$` at the very beginning/end of the
+     * pattern. Anything else makes the program ill-formed.
+     *
+     * @tparam Pattern The `uni_auto` string holding the pattern
+     */
+    template <uni_auto Pattern>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Pattern>)::value_type, char>
+    struct regex final {
+    private:
+        static constexpr auto program_size = uninttp_internals::re_compile(uni_auto_sv<Pattern>).insts.size();
+        static constexpr auto program = uninttp_internals::re_freeze<program_size>(uninttp_internals::re_compile(uni_auto_sv<Pattern>));
+        static constexpr auto shape = uninttp_internals::re_shape(program.insts, program.start);
+        static constexpr auto class_count = shape.classes;
+        static constexpr auto tables = uninttp_internals::re_freeze<shape.states, shape.classes>(uninttp_internals::re_determinize(program.insts, program.start));
+
+        /* Runs the DFA from `from`; gives the end of the longest match starting there */
+        static constexpr auto longest(const std::string_view s, const std::size_t from) noexcept {
+            std::size_t state = 1;
+            auto last = tables.accept[1] ? from : uninttp_internals::re_npos;
+            for (auto i = from; i < s.size(); i++) {
+                state = tables.delta[state * class_count + tables.classes[static_cast<unsigned char>(s[i])]];
+                if (state == 0)
+                    return program.anchored_end ? uninttp_internals::re_npos : last;
+                if (tables.accept[state])
+                    last = i + 1;
+            }
+            return !program.anchored_end || last == s.size() ? last : uninttp_internals::re_npos;
+        }
+
+    public:
+        /**
+         * @brief The submatches of a match; the element at index 0 is the whole match, and groups that didn't participate are empty views with a null `data()`.
+         */
+        using groups = std::array<std::string_view, program.groups + 1>;
+
+        /**
+         * @brief Gives the number of capturing groups in the pattern.
+         */
+        static constexpr auto group_count() noexcept {
+            return program.groups;
+        }
+
+        /**
+         * @brief Checks whether the whole of `s` matches the pattern.
+         */
+        static constexpr bool match(const std::string_view s) noexcept {
+            std::size_t state = 1;
+            for (const auto c : s)
+                if ((state = tables.delta[state * class_count + tables.classes[static_cast<unsigned char>(c)]]) == 0)
+                    return false;
+            return tables.accept[state];
+        }
+
+        /**
+         * @brief Finds the leftmost-longest match in `s`.
+         */
+        static constexpr auto search(const std::string_view s) noexcept -> std::optional<std::string_view> {
+            for (std::size_t from = 0; from <= s.size(); from++) {
+                if (program.anchored_begin && from > 0)
+                    break;
+                if (!tables.accept[1] && (from == s.size() || !tables.viable[static_cast<unsigned char>(s[from])]))
+                    continue;
+                if (const auto end = longest(s, from); end != uninttp_internals::re_npos)
+                    return s.substr(from, end - from);
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Like `match()`, but also extracts the submatches.
+         *
+         * Where the pattern is ambiguous, the submatches are resolved the way a backtracking engine would (leftmost alternatives first,
+         * greedy quantifiers take as much as they can).
+         */
+        static constexpr auto match_groups(const std::string_view s) -> std::optional<groups> {
+            if (!match(s))
+                return std::nullopt;
+            uninttp_internals::re_vm<program_size, 2 * (program.groups + 1)> vm{ program.insts };
+            const auto caps = vm.run(program.start, s);
+            groups g{};
+            for (std::size_t k = 0; k < g.size(); k++)
+                if ((*caps)[2 * k] != uninttp_internals::re_npos && (*caps)[2 * k + 1] != uninttp_internals::re_npos)
+                    g[k] = s.substr((*caps)[2 * k], (*caps)[2 * k + 1] - (*caps)[2 * k]);
+            return g;
+        }
+
+        /**
+         * @brief Like `search()`, but also extracts the submatches of the match found (the same way as `match_groups()` does).
+         */
+        static constexpr auto search_groups(const std::string_view s) -> std::optional<groups> {
+            if (const auto found = search(s))
+                return match_groups(*found);
+            return std::nullopt;
+        }
+    };
+}
+
+#endif /* UNINTTP_REGEX_HPP */
@@ -0,0 +1,641 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.render;
+
+import uninttp.uni_auto;
+import <type_traits>;
+import <string_view>;
+import <algorithm>;
+import <cstddef>;
+import <cstdint>;
+import <limits>;
+import <array>;
+import <bit>;
+
+export namespace uninttp::uninttp_internals {
+    /* Counts the characters it's given, and writes them out too unless `data` is null */
+    struct rd_output final {
+        char* data = nullptr;
+        std::size_t size = 0;
+
+        constexpr void put(const char c) noexcept {
+            if (data)
+                data[size] = c;
+            size++;
+        }
+
+        constexpr void put(const std::string_view s) noexcept {
+            for (const auto c : s)
+                put(c);
+        }
+
+        constexpr void put(const char c, const std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; i++)
+                put(c);
+        }
+    };
+
+    /* A standard format spec: `[[fill]align][sign][#][0][width][.precision][type]` */
+    struct rd_spec final {
+        char fill = ' ';
+        char align = 0;
+        char sign = '-';
+        bool alternate = false;
+        bool zero = false;
+        std::size_t width = 0;
+        std::size_t precision = static_cast<std::size_t>(-1);
+        char type = 0;
+    };
+
+    constexpr auto rd_parse_spec(const std::string_view spec) noexcept {
+        rd_spec out;
+        std::size_t i = 0;
+        const auto is_align = [](const char c) { return c == '<' || c == '>' || c == '^'; };
+        if (spec.size() >= 2 && is_align(spec[1])) {
+            out.fill = spec[0];
+            out.align = spec[1];
+            i = 2;
+        } else if (!spec.empty() && is_align(spec[0])) {
+            out.align = spec[0];
+            i = 1;
+        }
+        if (i < spec.size() && (spec[i] == '+' || spec[i] == '-' || spec[i] == ' '))
+            out.sign = spec[i++];
+        if (i < spec.size() && spec[i] == '#') {
+            out.alternate = true;
+            i++;
+        }
+        if (i < spec.size() && spec[i] == '0') {
+            out.zero = true;
+            i++;
+        }
+        for (; i < spec.size() && spec[i] >= '0' && spec[i] <= '9'; i++)
+            out.width = out.width * 10 + static_cast<std::size_t>(spec[i] - '0');
+        if (i < spec.size() && spec[i] == '.') {
+            out.precision = 0;
+            for (i++; i < spec.size() && spec[i] >= '0' && spec[i] <= '9'; i++)
+                out.precision = out.precision * 10 + static_cast<std::size_t>(spec[i] - '0');
+        }
+        if (i < spec.size())
+            out.type = spec[i++];
+        if (i < spec.size())
+            compile_time_error("malformed format spec");
+        return out;
+    }
+
+    /* Writes `body` (whose width is `size`) padded out to the spec's width, left-aligned unless `align` says otherwise */
+    template <typename Body>
+    constexpr void rd_pad(rd_output& out, const rd_spec& spec, const char align, const std::size_t size, Body body) noexcept {
+        const auto padding = spec.width > size ? spec.width - size : 0;
+        const auto a = spec.align ? spec.align : align;
+        const auto before = a == '>' ? padding : a == '^' ? padding / 2 : 0;
+        out.put(spec.fill, before);
+        body();
+        out.put(spec.fill, padding - before);
+    }
+
+    constexpr void rd_string(rd_output& out, std::string_view s, const rd_spec& spec) noexcept {
+        if (spec.type && spec.type != 's')
+            compile_time_error("invalid presentation type for a string");
+        if (spec.sign != '-' || spec.alternate || spec.zero)
+            compile_time_error("sign, # and 0 don't apply to strings");
+        s = s.substr(0, spec.precision);
+        rd_pad(out, spec, '<', s.size(), [&] { out.put(s); });
+    }
+
+    template <typename T>
+    constexpr void rd_integer(rd_output& out, const T value, const rd_spec& spec) noexcept {
+        if (spec.precision != static_cast<std::size_t>(-1))
+            compile_time_error("precision doesn't apply to integers");
+        if (spec.type == 'c') {
+            if (spec.sign != '-' || spec.alternate || spec.zero)
+                compile_time_error("sign, # and 0 don't apply to characters");
+            const auto fits = std::is_signed_v<T> ? static_cast<long long>(value) >= -128 && static_cast<long long>(value) <= 255
+                                                  : static_cast<unsigned long long>(value) <= 255;
+            if (!fits) // Any byte, whether `char` is signed or not
+                compile_time_error("the value doesn't fit in a character");
+            rd_pad(out, spec, '<', 1, [&] { out.put(static_cast<char>(value)); });
+            return;
+        }
+        unsigned long long base = 10;
+        std::string_view prefix;
+        switch (spec.type) {
+            case 'b': base = 2; prefix = "0b"; break;
+            case 'B': base = 2; prefix = "0B"; break;
+            case 'o': base = 8; prefix = value != 0 ? "0" : ""; break;
+            case 'x': base = 16; prefix = "0x"; break;
+            case 'X': base = 16; prefix = "0X"; break;
+            case 0: case 'd': break;
+            default: compile_time_error("invalid presentation type for an integer");
+        }
+        if (!spec.alternate)
+            prefix = {};
+        const auto digit_set = spec.type == 'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+        auto magnitude = static_cast<unsigned long long>(value);
+        if (value < 0)
+            magnitude = 0ULL - magnitude;
+        char digits[64] {};
+        std::size_t n = 0;
+        do {
+            digits[n++] = digit_set[magnitude % base];
+            magnitude /= base;
+        } while (magnitude);
+        const auto sign = value < 0 ? "-" : spec.sign == '+' ? "+" : spec.sign == ' ' ? " " : "";
+        const auto size = std::string_view(sign).size() + prefix.size() + n;
+        const auto emit_digits = [&] {
+            for (std::size_t i = n; i > 0; i--)
+                out.put(digits[i - 1]);
+        };
+        if (spec.zero && !spec.align) {
+            /* Zeros go between the sign and prefix and the digits */
+            out.put(sign);
+            out.put(prefix);
+            out.put('0', spec.width > size ? spec.width - size : 0);
+            emit_digits();
+        } else
+            rd_pad(out, spec, '>', size, [&] {
+                out.put(sign);
+                out.put(prefix);
+                emit_digits();
+            });
+    }
+
+    /* A fixed-capacity unsigned integer, wide enough for the exact arithmetic of the digit generation below (doubles need under 1200 bits) */
+    struct rd_bignum final {
+        std::array<std::uint32_t, 40> limbs{};
+        std::size_t size = 0;
+
+        constexpr rd_bignum(unsigned long long value = 0) noexcept {
+            for (; value; value >>= 32)
+                limbs[size++] = static_cast<std::uint32_t>(value);
+        }
+
+        constexpr rd_bignum& operator*=(const std::uint32_t m) noexcept {
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                const auto t = std::uint64_t(limbs[i]) * m + carry;
+                limbs[i] = static_cast<std::uint32_t>(t);
+                carry = t >> 32;
+            }
+            if (carry)
+                limbs[size++] = static_cast<std::uint32_t>(carry);
+            return *this;
+        }
+
+        constexpr rd_bignum& operator<<=(const std::size_t bits) noexcept {
+            if (!size)
+                return *this;
+            const auto words = bits / 32, shift = bits % 32;
+            limbs[size + words] = 0;
+            for (auto i = size; i > 0; i--) {
+                const auto t = (std::uint64_t(limbs[i - 1]) << shift);
+                limbs[i - 1 + words + 1] |= static_cast<std::uint32_t>(t >> 32);
+                limbs[i - 1 + words] = static_cast<std::uint32_t>(t);
+            }
+            for (std::size_t i = 0; i < words; i++)
+                limbs[i] = 0;
+            size += words + 1;
+            while (size && !limbs[size - 1])
+                size--;
+            return *this;
+        }
+
+        constexpr rd_bignum& operator+=(const rd_bignum& b) noexcept {
+            std::uint64_t carry = 0;
+            const auto n = std::max(size, b.size);
+            for (std::size_t i = 0; i < n; i++) {
+                const auto t = std::uint64_t(i < size ? limbs[i] : 0) + (i < b.size ? b.limbs[i] : 0) + carry;
+                limbs[i] = static_cast<std::uint32_t>(t);
+                carry = t >> 32;
+            }
+            size = n;
+            if (carry)
+                limbs[size++] = static_cast<std::uint32_t>(carry);
+            return *this;
+        }
+
+        /* Requires `*this >= b` */
+        constexpr rd_bignum& operator-=(const rd_bignum& b) noexcept {
+            std::int64_t borrow = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                const auto t = std::int64_t(limbs[i]) - (i < b.size ? b.limbs[i] : 0) - borrow;
+                borrow = t < 0;
+                limbs[i] = static_cast<std::uint32_t>(t + (borrow << 32));
+            }
+            while (size && !limbs[size - 1])
+                size--;
+            return *this;
+        }
+
+        constexpr void multiply_by_power_of_10(int k) noexcept {
+            for (; k >= 9; k -= 9)
+                *this *= 1000000000;
+            for (; k > 0; k--)
+                *this *= 10;
+        }
+
+        friend constexpr rd_bignum operator+(rd_bignum a, const rd_bignum& b) noexcept {
+            return a += b;
+        }
+
+        friend constexpr int compare(const rd_bignum& a, const rd_bignum& b) noexcept {
+            if (a.size != b.size)
+                return a.size < b.size ? -1 : 1;
+            for (auto i = a.size; i > 0; i--)
+                if (a.limbs[i - 1] != b.limbs[i - 1])
+                    return a.limbs[i - 1] < b.limbs[i - 1] ? -1 : 1;
+            return 0;
+        }
+    };
+
+    /* A binary floating-point value taken apart: `mantissa * 2^exponent`, or an infinity or a NaN */
+    struct rd_binary final {
+        std::uint64_t mantissa = 0;
+        int exponent = 0;
+        bool negative = false;
+        bool infinite = false;
+        bool nan = false;
+        bool lower_gap_smaller = false; /* At powers of two, the next value down is nearer than the next value up */
+    };
+
+    template <typename T>
+    constexpr auto rd_decompose(const T value) noexcept {
+        constexpr auto is_float = sizeof(T) == sizeof(float) && std::numeric_limits<T>::digits == 24;
+        constexpr auto is_double = sizeof(T) == sizeof(double) && std::numeric_limits<T>::digits == 53;
+        static_assert(is_float || is_double, "render: only IEEE-754 single and double precision floating-point values can be rendered at compile time");
+        constexpr auto fraction_bits = std::numeric_limits<T>::digits - 1;
+        constexpr auto exponent_bits = is_float ? 8 : 11;
+        constexpr auto bias = (1 << (exponent_bits - 1)) - 1 + fraction_bits;
+        const auto bits = static_cast<std::uint64_t>(std::bit_cast<std::conditional_t<is_float, std::uint32_t, std::uint64_t>>(value));
+        const auto fraction = bits & ((std::uint64_t(1) << fraction_bits) - 1);
+        const auto biased = static_cast<int>((bits >> fraction_bits) & ((1u << exponent_bits) - 1));
+        rd_binary out;
+        out.negative = bits >> (fraction_bits + exponent_bits);
+        if (biased == (1 << exponent_bits) - 1) {
+            out.infinite = !fraction;
+            out.nan = fraction;
+        } else if (biased == 0) {
+            out.mantissa = fraction;
+            out.exponent = 1 - bias;
+        } else {
+            out.mantissa = fraction | (std::uint64_t(1) << fraction_bits);
+            out.exponent = biased - bias;
+            out.lower_gap_smaller = !fraction && biased > 1;
+        }
+        return out;
+    }
+
+    /* Decimal digits with the value `0.digits * 10^exponent`; any digit past `size` is 0 (an exact double has no more than 767 significant ones) */
+    struct rd_decimal final {
+        std::array<char, 800> digits{};
+        std::size_t size = 0;
+        int exponent = 1;
+
+        constexpr char operator[](const long i) const noexcept {
+            return i >= 0 && static_cast<std::size_t>(i) < size ? digits[static_cast<std::size_t>(i)] : '0';
+        }
+    };
+
+    /* Sets up `r / s` as the value scaled down by `10^k` into [0.1, 1), and scales `m` (the gaps to the neighbouring values, if any) along */
+    constexpr auto rd_scale(const rd_binary& v, rd_bignum& r, rd_bignum& s, rd_bignum* const m_plus, rd_bignum* const m_minus) noexcept {
+        /* Everything is doubled (quadrupled where the lower gap is smaller) so that the half-gaps are integers */
+        const auto shift = v.lower_gap_smaller ? 2 : 1;
+        r = v.mantissa;
+        s = 1;
+        rd_bignum plus = 1, minus = 1;
+        if (v.exponent >= 0) {
+            r <<= static_cast<std::size_t>(v.exponent + shift);
+            s <<= static_cast<std::size_t>(shift);
+            plus <<= static_cast<std::size_t>(v.exponent + shift - 1);
+            minus <<= static_cast<std::size_t>(v.exponent);
+        } else {
+            r <<= static_cast<std::size_t>(shift);
+            s <<= static_cast<std::size_t>(shift - v.exponent);
+            plus <<= static_cast<std::size_t>(shift - 1);
+        }
+        /* log10(2) ~= 78913 / 2^18, so this is floor(log10(v)) or one less */
+        const auto e2 = v.exponent + static_cast<int>(std::bit_width(v.mantissa)) - 1;
+        auto k = (e2 >= 0 ? e2 * 78913 / (1 << 18) : -((-e2 * 78913 + (1 << 18) - 1) / (1 << 18))) + 1;
+        if (k >= 0)
+            s.multiply_by_power_of_10(k);
+        else {
+            r.multiply_by_power_of_10(-k);
+            plus.multiply_by_power_of_10(-k);
+            minus.multiply_by_power_of_10(-k);
+        }
+        if (m_plus) {
+            *m_plus = plus;
+            *m_minus = minus;
+        }
+        return k;
+    }
+
+    /* The shortest digits that read back as the same value, the nearest of them to it if there's a choice (after Steele & White, and Burger & Dybvig) */
+    constexpr auto rd_shortest(const rd_binary& v) noexcept {
+        rd_decimal out;
+        if (!v.mantissa) {
+            out.digits[0] = '0';
+            out.size = 1;
+            return out;
+        }
+        rd_bignum r, s, m_plus, m_minus;
+        auto k = rd_scale(v, r, s, &m_plus, &m_minus);
+        /* Round-to-even reading makes the boundaries themselves read back as the value when the mantissa is even */
+        const auto inclusive = v.mantissa % 2 == 0;
+        const auto too_high = [&](const int c) { return inclusive ? c >= 0 : c > 0; };
+        while (too_high(compare(r + m_plus, s))) {
+            s *= 10;
+            k++;
+        }
+        while (true) {
+            auto high = r + m_plus;
+            if (too_high(compare(high *= 10, s)))
+                break;
+            r *= 10;
+            m_plus *= 10;
+            m_minus *= 10;
+            k--;
+        }
+        out.exponent = k;
+        while (true) {
+            r *= 10;
+            m_plus *= 10;
+            m_minus *= 10;
+            char digit = 0;
+            for (; compare(r, s) >= 0; digit++)
+                r -= s;
+            const auto low = inclusive ? compare(r, m_minus) <= 0 : compare(r, m_minus) < 0;
+            const auto high = too_high(compare(r + m_plus, s));
+            if (low && high) {
+                const auto c = compare(r + r, s);
+                digit += c > 0 || (c == 0 && digit % 2);
+            } else if (high)
+                digit++;
+            out.digits[out.size++] = static_cast<char>('0' + digit);
+            if (low || high)
+                return out;
+        }
+    }
+
+    /* The exact value correctly rounded (half to even) to `count` significant digits, or else to `count` digits after the decimal point if `fixed` */
+    constexpr auto rd_rounded(const rd_binary& v, const long count, const bool fixed) noexcept {
+        rd_decimal out;
+        if (!v.mantissa)
+            return out;
+        rd_bignum r, s;
+        auto k = rd_scale(v, r, s, nullptr, nullptr);
+        while (compare(r, s) >= 0) {
+            s *= 10;
+            k++;
+        }
+        while (true) {
+            auto t = r;
+            if (compare(t *= 10, s) >= 0)
+                break;
+            r = t;
+            k--;
+        }
+        out.exponent = k;
+        const auto n = fixed ? k + count : count;
+        if (n < 0)
+            return out;
+        for (long i = 0; i < n && static_cast<std::size_t>(i) < out.digits.size(); i++) {
+            r *= 10;
+            char digit = 0;
+            for (; compare(r, s) >= 0; digit++)
+                r -= s;
+            out.digits[out.size++] = static_cast<char>('0' + digit);
+        }
+        const auto c = compare(r + r, s);
+        if (c > 0 || (c == 0 && out.size && (out.digits[out.size - 1] - '0') % 2)) {
+            auto i = out.size;
+            for (; i > 0 && out.digits[i - 1] == '9'; i--)
+                out.digits[i - 1] = '0';
+            if (i > 0)
+                out.digits[i - 1]++;
+            else {
+                /* All nines (or no digits at all) carried over into a new leading 1 */
+                out.digits[0] = '1';
+                out.size = std::max<std::size_t>(out.size, 1);
+                out.exponent++;
+            }
+        }
+        return out;
+    }
+
+    constexpr void rd_fixed(rd_output& out, const rd_decimal& d, const long precision, const bool point) noexcept {
+        if (d.exponent <= 0)
+            out.put('0');
+        for (long i = 0; i < d.exponent; i++)
+            out.put(d[i]);
+        if (precision > 0 || point)
+            out.put('.');
+        for (long i = 0; i < precision; i++)
+            out.put(d[d.exponent + i]);
+    }
+
+    constexpr void rd_scientific(rd_output& out, const rd_decimal& d, const long precision, const bool point, const bool upper) noexcept {
+        out.put(d[0]);
+        if (precision > 0 || point)
+            out.put('.');
+        for (long i = 1; i <= precision; i++)
+            out.put(d[i]);
+        out.put(upper ? 'E' : 'e');
+        const auto e = d.size && d[0] != '0' ? d.exponent - 1 : 0;
+        out.put(e < 0 ? '-' : '+');
+        const auto magnitude = e < 0 ? -e : e;
+        if (magnitude >= 100)
+            out.put(static_cast<char>('0' + magnitude / 100));
+        out.put(static_cast<char>('0' + magnitude / 10 % 10));
+        out.put(static_cast<char>('0' + magnitude % 10));
+    }
+
+    /* Like `std::to_chars()` with the format and precision the spec asks for, with the spec's sign, `#`, `0`, fill, alignment and width applied */
+    template <typename T>
+    constexpr void rd_floating(rd_output& out, const T value, const rd_spec& spec) noexcept {
+        const auto v = rd_decompose(value);
+        const auto type = spec.type;
+        if (type && type != 'e' && type != 'E' && type != 'f' && type != 'F' && type != 'g' && type != 'G')
+            compile_time_error(type == 'a' || type == 'A' ? "hexadecimal floating-point output isn't supported" : "invalid presentation type for a floating-point value");
+        const auto upper = type == 'E' || type == 'F' || type == 'G';
+        const auto has_precision = spec.precision != static_cast<std::size_t>(-1);
+        const auto precision = static_cast<long>(std::min<std::size_t>(has_precision ? spec.precision : 6, 1000));
+        const auto sign = v.negative ? "-" : spec.sign == '+' ? "+" : spec.sign == ' ' ? " " : "";
+        const auto body = [&](rd_output& o) {
+            if (v.infinite || v.nan) {
+                o.put(v.nan ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf"));
+                return;
+            }
+            if (type == 'e' || type == 'E')
+                rd_scientific(o, rd_rounded(v, precision + 1, false), precision, spec.alternate, upper);
+            else if (type == 'f' || type == 'F')
+                rd_fixed(o, rd_rounded(v, precision, true), precision, spec.alternate);
+            else if (type || has_precision) {
+                /* General: scientific only for exponents under -4 or at least the precision, and no trailing zeros short of `#` */
+                const auto p = std::max(precision, 1L);
+                const auto d = rd_rounded(v, p, false);
+                const auto x = d.size && d[0] != '0' ? d.exponent - 1 : 0;
+                auto significant = p;
+                if (!spec.alternate)
+                    while (significant > 1 && d[significant - 1] == '0')
+                        significant--;
+                if (x < -4 || x >= p)
+                    rd_scientific(o, d, significant - 1, spec.alternate, upper);
+                else
+                    rd_fixed(o, d, std::max(significant - 1 - x, spec.alternate ? p - 1 - x : 0L), spec.alternate);
+            } else {
+                /* Shortest round trip, in whichever of fixed and scientific notation is shorter (fixed on a tie) */
+                const auto d = rd_shortest(v);
+                const auto n = static_cast<long>(d.size), k = d.exponent;
+                const auto x = d[0] != '0' ? k - 1 : 0;
+                const auto scientific_size = n + (n > 1) + 2 + (x <= -100 || x >= 100 ? 3 : 2);
+                const auto fixed_size = k <= 0 ? 2 - k + n : k < n ? n + 1 : k;
+                if (scientific_size < fixed_size)
+                    rd_scientific(o, d, n - 1, spec.alternate, false);
+                else if (k > n)
+                    /* Padding the digits with zeros takes as many characters as the nearest integer does, which is nearer */
+                    rd_fixed(o, rd_rounded(v, 0, true), 0, spec.alternate);
+                else
+                    rd_fixed(o, d, n - k, spec.alternate);
+            }
+        };
+        rd_output counter;
+        body(counter);
+        const auto size = std::string_view(sign).size() + counter.size;
+        if (spec.zero && !spec.align && !v.infinite && !v.nan) {
+            out.put(sign);
+            out.put('0', spec.width > size ? spec.width - size : 0);
+            body(out);
+        } else
+            rd_pad(out, spec, '>', size, [&] {
+                out.put(sign);
+                body(out);
+            });
+    }
+
+    /* Parses the spec of a range, `[n][:element-spec]`, into whether to bracket the elements and the spec of the elements */
+    constexpr auto rd_parse_range_spec(std::string_view spec, bool& brackets) noexcept {
+        brackets = true;
+        if (!spec.empty() && spec[0] == 'n') {
+            brackets = false;
+            spec.remove_prefix(1);
+        }
+        if (!spec.empty() && spec[0] != ':')
+            compile_time_error("malformed range spec (only `n` and an element spec after `:` are supported)");
+        return spec.substr(std::min<std::size_t>(spec.size(), 1));
+    }
+
+    /*
+     * Renders `value` into `out` the way `std::format()` would with `spec` (what comes after the `:` of a replacement field),
+     * for integers, floating-point values, characters, `bool`, enumerations, strings and arrays of those.
+     */
+    template <typename T>
+    constexpr void rd_render(rd_output& out, const T& value, const std::string_view spec) noexcept {
+        using U = std::remove_cv_t<T>;
+        if constexpr (std::is_array_v<U> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<U>>, char>) {
+            const std::string_view s { value, std::size(value) };
+            rd_string(out, s.substr(0, s.find('\0')), rd_parse_spec(spec));
+        } else if constexpr (std::is_array_v<U>) {
+            auto brackets = true;
+            const auto element_spec = rd_parse_range_spec(spec, brackets);
+            if (brackets)
+                out.put('[');
+            for (std::size_t i = 0; i < std::size(value); i++) {
+                if (i > 0)
+                    out.put(", ");
+                rd_render(out, value[i], element_spec);
+            }
+            if (brackets)
+                out.put(']');
+        } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>)
+            rd_string(out, value, rd_parse_spec(spec));
+        else if constexpr (std::is_convertible_v<const U&, std::string_view> && !std::is_arithmetic_v<U>)
+            rd_string(out, value, rd_parse_spec(spec));
+        else if constexpr (std::is_same_v<U, bool>) {
+            const auto s = rd_parse_spec(spec);
+            if (!s.type || s.type == 's')
+                rd_string(out, value ? "true" : "false", s);
+            else
+                rd_integer(out, static_cast<int>(value), s);
+        } else if constexpr (std::is_same_v<U, char>) {
+            const auto s = rd_parse_spec(spec);
+            if (!s.type || s.type == 'c')
+                rd_integer(out, static_cast<int>(value), [&] { auto c = s; c.type = 'c'; return c; }());
+            else
+                rd_integer(out, value, s);
+        } else if constexpr (std::is_integral_v<U>)
+            rd_integer(out, value, rd_parse_spec(spec));
+        else if constexpr (std::is_floating_point_v<U>)
+            rd_floating(out, value, rd_parse_spec(spec));
+        else if constexpr (std::is_enum_v<U>)
+            rd_integer(out, static_cast<std::underlying_type_t<U>>(value), rd_parse_spec(spec));
+        else
+            static_assert(!sizeof(T), "render: only integers, floating-point values, characters, `bool`, enumerations, strings and arrays of those can be rendered at compile time");
+    }
+
+    template <uni_auto Value, uni_auto Spec>
+    struct rd_rendered final {
+        static constexpr auto size = [] {
+            rd_output out;
+            rd_render(out, uni_auto_v<Value>, uni_auto_sv<Spec>);
+            return out.size;
+        }();
+
+        static constexpr auto text = [] {
+            std::array<char, size + 1> buffer{};
+            rd_output out { buffer.data() };
+            rd_render(out, uni_auto_v<Value>, uni_auto_sv<Spec>);
+            return buffer;
+        }();
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief The text that `std::format()` would produce for `Value` with the format spec `Spec`, rendered at compile time.
+     *
+     * Integers, floating-point values (except in hexadecimal), characters, `bool`, enumerations (as their underlying values), strings, and arrays of those are supported (not arrays of arrays, which `uni_auto` can't hold).
+     * Arrays take range specs (`n` to drop the brackets, and an element spec after a `:`; e.g., `"n:#04x"`), and character arrays are rendered as strings.
+     * Like the `std::formatter` of `uni_auto`, elements are rendered as they would be on their own (i.e., strings and characters aren't quoted).
+     * The text is null-terminated.
+     *
+     * @tparam Value The `uni_auto` value
+     * @tparam Spec The `uni_auto` format spec (i.e., what would follow the `:` in a replacement field)
+     */
+    template <uni_auto Value, uni_auto Spec = "">
+        requires std::is_same_v<typename decltype(uni_auto_sv<Spec>)::value_type, char>
+    constexpr std::string_view render_v { uninttp_internals::rd_rendered<Value, Spec>::text.data(), uninttp_internals::rd_rendered<Value, Spec>::size };
+}
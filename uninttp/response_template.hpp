@@ -0,0 +1,204 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_RESPONSE_TEMPLATE_HPP
+#define UNINTTP_RESPONSE_TEMPLATE_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <charconv>
+#include <optional>
+#include <cstddef>
+#include <utility>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        /* A run of constant text (within the unescaped text), or a placeholder if `placeholder` is set */
+        struct rt_segment final {
+            std::size_t offset = 0;
+            std::size_t size = 0;
+            bool placeholder = false;
+        };
+
+        struct rt_split final {
+            std::size_t text_size = 0;
+            std::size_t segment_count = 0;
+            std::size_t placeholder_count = 0;
+        };
+
+        /* Splits `format` into constant text (unescaped into `text`, if any) and placeholders (into `segments`, if any) */
+        constexpr auto rt_parse(const std::string_view format, char* const text, rt_segment* const segments) noexcept {
+            rt_split out;
+            std::size_t start = 0;
+            const auto end_text = [&] {
+                if (out.text_size > start) {
+                    if (segments)
+                        segments[out.segment_count] = { start, out.text_size - start, false };
+                    out.segment_count++;
+                }
+            };
+            for (std::size_t i = 0; i < format.size(); i++) {
+                const auto c = format[i];
+                if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+                    i++;
+                else if (c == '{') {
+                    if (i + 1 >= format.size() || format[i + 1] != '}') {
+                        compile_time_error("placeholders must be written as {}");
+                        return out;
+                    }
+                    i++;
+                    end_text();
+                    if (segments)
+                        segments[out.segment_count] = { out.placeholder_count, 0, true };
+                    out.segment_count++;
+                    out.placeholder_count++;
+                    start = out.text_size;
+                    continue;
+                } else if (c == '}') {
+                    compile_time_error("unmatched } (write }} for a literal one)");
+                    return out;
+                }
+                if (text)
+                    text[out.text_size] = c;
+                out.text_size++;
+            }
+            end_text();
+            return out;
+        }
+
+        template <typename T>
+        concept rt_iovec = requires(T v) {
+            v.iov_base = static_cast<void*>(nullptr);
+            v.iov_len = std::size_t{};
+        };
+
+        /* Formats `value` into the scratch space at `p` (if it needs to be) and gives the bytes that make it up; clears `ok` if it didn't fit */
+        template <typename T>
+        std::string_view rt_format(const T& value, char*& p, char* const last, bool& ok) noexcept {
+            if constexpr (std::is_convertible_v<const T&, std::string_view>)
+                return value;
+            else if constexpr (std::is_same_v<T, char>) {
+                if (p == last) {
+                    ok = false;
+                    return {};
+                }
+                *p = value;
+                return { p++, 1 };
+            } else if constexpr (std::is_same_v<T, bool>)
+                return value ? "true" : "false";
+            else if constexpr (std::is_enum_v<T>)
+                return rt_format(static_cast<std::underlying_type_t<T>>(value), p, last, ok);
+            else {
+                static_assert(std::is_arithmetic_v<T>, "response_template: unsupported argument type");
+                const auto [end, ec] = std::to_chars(p, last, value);
+                if (ec != std::errc{}) {
+                    ok = false;
+                    return {};
+                }
+                const std::string_view out { p, static_cast<std::size_t>(end - p) };
+                p = end;
+                return out;
+            }
+        }
+    }
+
+    /**
+     * @brief A format string split at compile time into constant segments and `{}` placeholders, for gathered writes (e.g., `writev()`).
+     *
+     * Filling the template points one I/O vector at each segment: constant text is referred to where it's stored and strings are referred
+     * to where they are, so only numbers get formatted (into caller-provided scratch space). `{{` and `}}` stand for literal braces.
+     *
+     * @tparam Format The `uni_auto` format string
+     */
+    template <uni_auto Format>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Format>)::value_type, char>
+    struct response_template final {
+    private:
+        static constexpr auto split = uninttp_internals::rt_parse(uni_auto_sv<Format>, nullptr, nullptr);
+
+        static constexpr auto text = [] {
+            std::array<char, split.text_size + 1> out{};
+            uninttp_internals::rt_parse(uni_auto_sv<Format>, out.data(), nullptr);
+            return out;
+        }();
+
+        static constexpr auto segments = [] {
+            std::array<uninttp_internals::rt_segment, split.segment_count> out{};
+            uninttp_internals::rt_parse(uni_auto_sv<Format>, nullptr, out.data());
+            return out;
+        }();
+
+    public:
+        /**
+         * @brief The number of I/O vectors that `fill()` takes up.
+         */
+        static constexpr std::size_t segment_count = split.segment_count;
+
+        /**
+         * @brief The number of placeholders, i.e., of arguments to `fill()`.
+         */
+        static constexpr std::size_t placeholder_count = split.placeholder_count;
+
+        /**
+         * @brief Points `segment_count` I/O vectors at `iov` (anything with `iov_base` and `iov_len`, e.g., `iovec`) to the segments in turn.
+         *
+         * Strings (anything convertible to `std::string_view`) and `bool`s are referred to in place; characters, numbers and enumerations
+         * (as their underlying integers) are formatted into `[scratch, scratch_last)`. Strings must outlive the I/O vectors.
+         *
+         * @return The total number of bytes (which may be 0), or `std::nullopt` if the scratch space ran out
+         */
+        template <uninttp_internals::rt_iovec Iovec, typename... Args>
+            requires (sizeof...(Args) == placeholder_count)
+        static std::optional<std::size_t> fill(Iovec* const iov, [[maybe_unused]] char* scratch, [[maybe_unused]] char* const scratch_last, const Args&... args) noexcept {
+            auto ok = true;
+            std::array<std::string_view, sizeof...(Args)> values { uninttp_internals::rt_format(args, scratch, scratch_last, ok)... };
+            if (!ok)
+                return std::nullopt;
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < segments.size(); i++) {
+                const auto [offset, size, placeholder] = segments[i];
+                const auto s = placeholder ? values[offset] : std::string_view { text.data() + offset, size };
+                iov[i].iov_base = const_cast<char*>(s.data());
+                iov[i].iov_len = s.size();
+                total += s.size();
+            }
+            return total;
+        }
+    };
+}
+
+#endif /* UNINTTP_RESPONSE_TEMPLATE_HPP */
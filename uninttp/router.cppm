@@ -0,0 +1,282 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+export module uninttp.router;
+
+import uninttp.uni_auto;
+import uninttp.json_reader;
+import <type_traits>;
+import <string_view>;
+import <functional>;
+import <algorithm>;
+import <optional>;
+import <cstddef>;
+import <utility>;
+import <array>;
+import <tuple>;
+
+namespace uninttp::uninttp_internals {
+    inline constexpr auto ro_none = static_cast<std::size_t>(-1);
+
+    /* A node of the segment trie: where a `{parameter}` segment leads, and which route (if any) ends here */
+    struct ro_node final {
+        std::size_t parameter = ro_none;
+        std::size_t route = ro_none;
+    };
+
+    /* A literal segment leading from `parent` to `child`; its text lies within the pooled route patterns */
+    struct ro_edge final {
+        std::size_t parent = ro_none;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        std::size_t child = ro_none;
+    };
+
+    /* Calls `f(segment, is_parameter)` on each segment of a route pattern, checking the pattern as it goes */
+    template <typename F>
+    constexpr void ro_segments(const std::string_view pattern, F f) noexcept {
+        if (!pattern.starts_with('/')) {
+            compile_time_error("a route must start with /");
+            return;
+        }
+        for (std::size_t i = 1; i <= pattern.size();) {
+            const auto end = std::min(pattern.find('/', i), pattern.size());
+            const auto segment = pattern.substr(i, end - i);
+            const auto parameter = segment.starts_with('{') && segment.ends_with('}') && segment.size() > 2;
+            if (segment.substr(parameter, segment.size() - 2 * parameter).find_first_of("{}") != std::string_view::npos)
+                compile_time_error("a parameter takes up a whole segment, as in /{name}/");
+            f(segment, parameter);
+            i = end + 1;
+        }
+    }
+
+    template <typename... Routes>
+    struct ro_trie final {
+        /* Every pattern, back to back, so that an edge can refer to its segment by offset */
+        static constexpr auto pool = [] {
+            std::array<char, (Routes::pattern.size() + ... + 0)> out{};
+            std::size_t n = 0;
+            ((std::copy(Routes::pattern.begin(), Routes::pattern.end(), out.begin() + n), n += Routes::pattern.size()), ...);
+            return out;
+        }();
+
+        static constexpr auto pool_sv = std::string_view { pool.data(), pool.size() };
+
+        static constexpr std::array<std::string_view, sizeof...(Routes)> patterns { Routes::pattern... };
+
+        struct built final {
+            std::array<ro_node, pool.size() + 1> nodes{};
+            std::array<ro_edge, pool.size() + 1> edges{};
+            std::size_t node_count = 1;
+            std::size_t edge_count = 0;
+        };
+
+        static constexpr auto trie = [] {
+            built out;
+            std::size_t offset = 0;
+            for (std::size_t r = 0; r < patterns.size(); r++) {
+                std::size_t node = 0;
+                ro_segments(patterns[r], [&](const std::string_view segment, const bool parameter) {
+                    if (parameter) {
+                        if (out.nodes[node].parameter == ro_none)
+                            out.nodes[node].parameter = out.node_count++;
+                        node = out.nodes[node].parameter;
+                        return;
+                    }
+                    const auto at = offset + static_cast<std::size_t>(segment.data() - patterns[r].data());
+                    for (std::size_t e = 0; e < out.edge_count; e++)
+                        if (out.edges[e].parent == node && pool_sv.substr(out.edges[e].offset, out.edges[e].size) == segment) {
+                            node = out.edges[e].child;
+                            return;
+                        }
+                    out.edges[out.edge_count++] = { node, at, segment.size(), out.node_count };
+                    node = out.node_count++;
+                });
+                if (out.nodes[node].route != ro_none)
+                    compile_time_error("two routes match the same paths");
+                out.nodes[node].route = r;
+                offset += patterns[r].size();
+            }
+            return out;
+        }();
+
+        static constexpr auto nodes = [] {
+            std::array<ro_node, trie.node_count> out{};
+            std::copy_n(trie.nodes.begin(), out.size(), out.begin());
+            return out;
+        }();
+
+        /* Each literal segment is hashed along with the node it leaves, so that a single table holds the edges of every node */
+        static constexpr auto hash = [] {
+            std::array<std::string_view, trie.edge_count> segments{};
+            std::array<std::size_t, trie.edge_count> parents{};
+            for (std::size_t e = 0; e < trie.edge_count; e++) {
+                segments[e] = pool_sv.substr(trie.edges[e].offset, trie.edges[e].size);
+                parents[e] = trie.edges[e].parent;
+            }
+            return jr_perfect_hash(segments, parents);
+        }();
+
+        /* The edges, each in the slot that its hash picks */
+        static constexpr auto edges = [] {
+            std::array<ro_edge, std::size_t{ 1 } << hash.bits> out{};
+            for (std::size_t e = 0; e < trie.edge_count; e++)
+                out[hash(pool_sv.substr(trie.edges[e].offset, trie.edges[e].size), trie.edges[e].parent)] = trie.edges[e];
+            return out;
+        }();
+
+        static constexpr auto child(const std::size_t node, const std::string_view segment) noexcept {
+            const auto& e = edges[hash(segment, node)];
+            return e.parent == node && std::string_view { pool.data() + e.offset, e.size } == segment ? e.child : ro_none;
+        }
+
+        /* Matches the segments of `path` (past a `/`) from `node` on, preferring literal segments and backing off to parameters */
+        template <std::size_t N>
+        static constexpr std::size_t match(const std::size_t node, const std::string_view path, std::array<std::string_view, N>& parameters, const std::size_t depth) noexcept {
+            const auto end = std::min(path.find('/'), path.size());
+            const auto segment = std::string_view { path.data(), end };
+            const auto last = end == path.size();
+            const auto rest = last ? std::string_view{} : std::string_view { path.data() + end + 1, path.size() - end - 1 };
+            if (const auto next = child(node, segment); next != ro_none) {
+                const auto route = last ? nodes[next].route : match(next, rest, parameters, depth);
+                if (route != ro_none)
+                    return route;
+            }
+            if (const auto next = nodes[node].parameter; next != ro_none && !segment.empty()) {
+                const auto route = last ? nodes[next].route : match(next, rest, parameters, depth + 1);
+                if (route != ro_none) {
+                    if constexpr (N > 0)
+                        parameters[depth] = segment;
+                    return route;
+                }
+            }
+            return ro_none;
+        }
+    };
+}
+
+export namespace uninttp {
+    /**
+     * @brief A route: a path pattern, in which a `{name}` segment matches any non-empty segment, and the handler to call for matching paths.
+     * @tparam Pattern The `uni_auto` path pattern (e.g., `"/v1/orders/{id}"`)
+     * @tparam Handler The `uni_auto` handler (e.g., a function pointer)
+     */
+    template <uni_auto Pattern, uni_auto Handler>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Pattern>)::value_type, char>
+    struct route final {
+        static constexpr auto pattern = uni_auto_sv<Pattern>;
+        static constexpr auto handler = uni_auto_simplify_v<Handler>;
+        static constexpr auto parameter_count = [] {
+            std::size_t n = 0;
+            uninttp_internals::ro_segments(pattern, [&](std::string_view, const bool parameter) { n += parameter; });
+            return n;
+        }();
+
+        /**
+         * @brief Calls the handler with `args...` followed by the first `parameter_count` of `parameters`.
+         * @return Whatever the handler returns
+         */
+        template <typename... Args>
+        static constexpr decltype(auto) call(const std::string_view* const parameters, Args&&... args) {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) -> decltype(auto) {
+                return std::invoke(handler, std::forward<Args>(args)..., parameters[I]...);
+            }(std::make_index_sequence<parameter_count>{});
+        }
+    };
+
+    /**
+     * @brief Dispatches paths to the handlers of the routes that they match, through a segment trie built at compile time.
+     *
+     * Literal segments are looked up in a perfectly hashed table of all the trie's edges (one probe per segment), with `{parameter}`
+     * segments tried only where the literal ones lead nowhere. Handlers are called directly, never through a table of function pointers,
+     * and receive the parameters as `std::string_view`s into the path.
+     *
+     * @tparam Routes The `route`s
+     */
+    template <typename... Routes>
+    struct router final {
+    private:
+        using trie = uninttp_internals::ro_trie<Routes...>;
+
+        template <typename... Args>
+        using result_t = std::common_type_t<decltype(Routes::call(std::declval<const std::string_view*>(), std::declval<Args>()...))...>;
+
+        template <std::size_t Index>
+        using route_at = std::tuple_element_t<Index, std::tuple<Routes...>>;
+
+    public:
+        /**
+         * @brief The number of routes, which is also what `match()` returns when no route matches.
+         */
+        static constexpr std::size_t route_count = sizeof...(Routes);
+
+        /**
+         * @brief The largest number of parameters that a route has.
+         */
+        static constexpr std::size_t max_parameters = std::max({ std::size_t{ 0 }, Routes::parameter_count... });
+
+        /**
+         * @brief Finds the route that `path` matches (anything from a `?` on is ignored), filling in its parameters.
+         * @return The index of the route, or `route_count` if there's none
+         */
+        static constexpr std::size_t match(std::string_view path, std::array<std::string_view, max_parameters>& parameters) noexcept {
+            path = path.substr(0, path.find('?'));
+            if (!path.starts_with('/'))
+                return route_count;
+            const auto route = trie::match(0, path.substr(1), parameters, 0);
+            return route == uninttp_internals::ro_none ? route_count : route;
+        }
+
+        /**
+         * @brief Calls the handler of the route that `path` matches with `args...` followed by the route's parameters.
+         * @return If the handlers return `void`, whether a route matched; otherwise, what the handler returned (converted to the handlers'
+         *         common type), or `std::nullopt` if no route matched
+         */
+        template <typename... Args>
+        static constexpr auto dispatch(const std::string_view path, Args&&... args) {
+            std::array<std::string_view, max_parameters> parameters{};
+            const auto index = match(path, parameters);
+            return [&]<std::size_t... I>(std::index_sequence<I...>) {
+                if constexpr (std::is_void_v<result_t<Args...>>)
+                    return ((index == I && (route_at<I>::call(parameters.data(), std::forward<Args>(args)...), true)) || ...);
+                else {
+                    std::optional<result_t<Args...>> out;
+                    ((index == I && (out.emplace(route_at<I>::call(parameters.data(), std::forward<Args>(args)...)), true)) || ...);
+                    return out;
+                }
+            }(std::index_sequence_for<Routes...>{});
+        }
+    };
+}
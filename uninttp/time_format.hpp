@@ -0,0 +1,393 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_TIME_FORMAT_HPP
+#define UNINTTP_TIME_FORMAT_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <system_error>
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <limits>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        enum tf_field_kind : std::size_t {
+            tf_year, tf_month, tf_day, tf_hour, tf_minute, tf_second, tf_fraction, tf_field_count
+        };
+
+        /* Where each field's digits lie (`width` 0 if the pattern lacks it), and the pattern's literal characters ('\0' at digits) */
+        struct tf_layout final {
+            std::size_t size = 0;
+            std::array<std::size_t, tf_field_count> offset{};
+            std::array<std::size_t, tf_field_count> width{};
+        };
+
+        constexpr auto tf_parse(const std::string_view pattern, char* const literal) noexcept {
+            tf_layout out;
+            for (std::size_t i = 0; i < pattern.size(); i++) {
+                if (pattern[i] != '%') {
+                    if (literal)
+                        literal[out.size] = pattern[i];
+                    out.size++;
+                    continue;
+                }
+                if (++i >= pattern.size()) {
+                    compile_time_error("the pattern ends in a lone %");
+                    return out;
+                }
+                std::size_t digits = 0;
+                if (pattern[i] >= '1' && pattern[i] <= '9' && i + 1 < pattern.size() && pattern[i + 1] == 'f')
+                    digits = static_cast<std::size_t>(pattern[i++] - '0');
+                tf_field_kind kind = tf_field_count;
+                std::size_t width = 2;
+                switch (pattern[i]) {
+                    case 'Y': kind = tf_year; width = 4; break;
+                    case 'm': kind = tf_month; break;
+                    case 'd': kind = tf_day; break;
+                    case 'H': kind = tf_hour; break;
+                    case 'M': kind = tf_minute; break;
+                    case 'S': kind = tf_second; break;
+                    case 'f': kind = tf_fraction; width = digits ? digits : 6; break;
+                    case '%':
+                        if (literal)
+                            literal[out.size] = '%';
+                        out.size++;
+                        continue;
+                    default:
+                        compile_time_error("unsupported conversion specifier (supported: %Y %m %d %H %M %S %f %3f %6f %9f %%)");
+                        return out;
+                }
+                if (kind == tf_fraction && width != 3 && width != 6 && width != 9)
+                    compile_time_error("fractions of a second take 3, 6 or 9 digits");
+                if (out.width[kind]) {
+                    compile_time_error("a conversion specifier appears twice");
+                    return out;
+                }
+                out.offset[kind] = out.size;
+                out.width[kind] = width;
+                if (literal)
+                    for (std::size_t j = 0; j < width; j++)
+                        literal[out.size + j] = '\0';
+                out.size += width;
+            }
+            return out;
+        }
+
+        /* The 8-byte words that the validation goes through: the last one is pulled back to end with the text (they then overlap) */
+        struct tf_chunk final {
+            std::size_t offset = 0;
+            std::uint64_t literal = 0;
+            std::uint64_t literal_mask = 0;
+            std::uint64_t digit_mask = 0;
+        };
+
+        template <uni_auto Pattern>
+        struct tf_compiled final {
+            static constexpr auto layout = tf_parse(uni_auto_sv<Pattern>, nullptr);
+
+            static constexpr auto literal = [] {
+                std::array<char, layout.size> out{};
+                tf_parse(uni_auto_sv<Pattern>, out.data());
+                return out;
+            }();
+
+            static constexpr auto chunks = [] {
+                std::array<tf_chunk, layout.size >= 8 ? (layout.size + 7) / 8 : 0> out{};
+                for (std::size_t i = 0; i < out.size(); i++) {
+                    out[i].offset = std::min(i * 8, layout.size - 8);
+                    std::array<char, 8> lit{}, lit_mask{}, digit_mask{};
+                    for (std::size_t j = 0; j < 8; j++) {
+                        const auto c = literal[out[i].offset + j];
+                        lit[j] = c;
+                        lit_mask[j] = c ? '\xFF' : '\0';
+                        digit_mask[j] = c ? '\0' : '\xFF';
+                    }
+                    out[i].literal = std::bit_cast<std::uint64_t>(lit);
+                    out[i].literal_mask = std::bit_cast<std::uint64_t>(lit_mask);
+                    out[i].digit_mask = std::bit_cast<std::uint64_t>(digit_mask);
+                }
+                return out;
+            }();
+        };
+
+        /* Checks every literal character and that every digit position holds a digit, 8 bytes at a time */
+        template <uni_auto Pattern>
+        inline bool tf_matches(const char* const p) noexcept {
+            using compiled = tf_compiled<Pattern>;
+            if constexpr (compiled::layout.size < 8) {
+                auto ok = true;
+                for (std::size_t i = 0; i < compiled::layout.size; i++)
+                    ok &= compiled::literal[i] ? p[i] == compiled::literal[i] : static_cast<unsigned char>(p[i] - '0') < 10;
+                return ok;
+            } else {
+                constexpr std::uint64_t high_nibbles = 0xF0F0F0F0F0F0F0F0, threes = 0x3030303030303030, sixes = 0x0606060606060606;
+                std::uint64_t bad = 0;
+                for (const auto& chunk : compiled::chunks) {
+                    std::uint64_t w;
+                    std::memcpy(&w, p + chunk.offset, 8);
+                    const auto digits = w & chunk.digit_mask;
+                    /* A digit is 0x3N with N <= 9, i.e., one whose high nibble stays 3 after adding 6 */
+                    bad |= ((w ^ chunk.literal) & chunk.literal_mask)
+                         | ((digits & high_nibbles) ^ (threes & chunk.digit_mask))
+                         | (((digits + (sixes & chunk.digit_mask)) & high_nibbles) ^ (threes & chunk.digit_mask));
+                }
+                return !bad;
+            }
+        }
+
+        /* Converts `Width` digits, packing up to 8 of them into a word (behind leading '0's) and combining them pairwise */
+        template <std::size_t Width>
+        inline std::uint32_t tf_digits(const char* const p) noexcept {
+            if constexpr (Width > 8)
+                return tf_digits<Width - 8>(p) * 100000000 + tf_digits<8>(p + Width - 8);
+            else if constexpr (Width <= 2 || std::endian::native != std::endian::little) {
+                std::uint32_t v = 0;
+                for (std::size_t i = 0; i < Width; i++)
+                    v = v * 10 + static_cast<std::uint32_t>(p[i] - '0');
+                return v;
+            } else {
+                std::uint64_t v = 0x3030303030303030;
+                std::memcpy(reinterpret_cast<char*>(&v) + (8 - Width), p, Width);
+                v -= 0x3030303030303030;
+                v = (v * 10 + (v >> 8)) & 0x00FF00FF00FF00FF;
+                v = (v * 100 + (v >> 16)) & 0x0000FFFF0000FFFF;
+                return static_cast<std::uint32_t>((v * 10000 + (v >> 32)) & 0xFFFFFFFF);
+            }
+        }
+
+        /* "00" through "99" */
+        inline constexpr auto tf_pairs = [] {
+            std::array<char, 200> out{};
+            for (std::size_t i = 0; i < 100; i++) {
+                out[i * 2] = static_cast<char>('0' + i / 10);
+                out[i * 2 + 1] = static_cast<char>('0' + i % 10);
+            }
+            return out;
+        }();
+
+        template <std::size_t Width>
+        inline void tf_put(char* const p, std::uint32_t v) noexcept {
+            for (auto i = Width; i >= 2; i -= 2) {
+                std::memcpy(p + i - 2, tf_pairs.data() + v % 100 * 2, 2);
+                v /= 100;
+            }
+            if constexpr (Width % 2)
+                p[0] = static_cast<char>('0' + v);
+        }
+
+        /* Days since 1970-01-01 of a date of the proleptic Gregorian calendar (after Howard Hinnant's `days_from_civil()`) */
+        constexpr std::int32_t tf_days_from_civil(std::int32_t y, const std::uint32_t m, const std::uint32_t d) noexcept {
+            y -= m <= 2;
+            const auto era = (y >= 0 ? y : y - 399) / 400;
+            const auto yoe = static_cast<std::uint32_t>(y - era * 400);
+            const auto doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+            const auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + static_cast<std::int32_t>(doe) - 719468;
+        }
+
+        struct tf_civil final {
+            std::int32_t year;
+            std::uint32_t month;
+            std::uint32_t day;
+        };
+
+        constexpr tf_civil tf_civil_from_days(std::int32_t z) noexcept {
+            z += 719468;
+            const auto era = (z >= 0 ? z : z - 146096) / 146097;
+            const auto doe = static_cast<std::uint32_t>(z - era * 146097);
+            const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            const auto mp = (5 * doy + 2) / 153;
+            const auto d = doy - (153 * mp + 2) / 5 + 1;
+            const auto m = mp < 10 ? mp + 3 : mp - 9;
+            return { static_cast<std::int32_t>(yoe) + era * 400 + (m <= 2), m, d };
+        }
+
+        /* 2 bits per month (from bit 2 on) for how many days past 28 it has in a common year */
+        inline constexpr std::uint32_t tf_extra_days = [] {
+            constexpr std::uint32_t days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            std::uint32_t out = 0;
+            for (std::uint32_t m = 1; m <= 12; m++)
+                out |= (days[m - 1] - 28) << (m * 2);
+            return out;
+        }();
+    }
+
+    /**
+     * @brief A fixed-width timestamp format compiled from a `strftime()`-style pattern, with a branch-free parser and printer.
+     *
+     * Supports `%Y` (4 digits), `%m`, `%d`, `%H`, `%M`, `%S` (2 digits each), `%f` (microseconds, or `%3f`/`%9f` for milliseconds/nanoseconds) and `%%`.
+     * Every field having a fixed width, each one lies at a fixed offset, so parsing takes no scanning: literals and digits are validated
+     * 8 bytes at a time, and each field is converted with a few multiplications. Missing date fields default to 1970-01-01 and missing time fields to 0.
+     *
+     * @tparam Pattern The `uni_auto` pattern
+     */
+    template <uni_auto Pattern>
+        requires std::is_same_v<typename decltype(uni_auto_sv<Pattern>)::value_type, char>
+    struct time_format final {
+    private:
+        using compiled = uninttp_internals::tf_compiled<Pattern>;
+        static constexpr auto layout = compiled::layout;
+
+        template <uninttp_internals::tf_field_kind Kind>
+        static std::uint32_t field(const char* const p, const std::uint32_t fallback) noexcept {
+            if constexpr (layout.width[Kind] != 0)
+                return uninttp_internals::tf_digits<layout.width[Kind]>(p + layout.offset[Kind]);
+            else
+                return fallback;
+        }
+
+        template <uninttp_internals::tf_field_kind Kind>
+        static void put(char* const p, const std::uint32_t v) noexcept {
+            if constexpr (layout.width[Kind] != 0)
+                uninttp_internals::tf_put<layout.width[Kind]>(p + layout.offset[Kind], v);
+        }
+
+    public:
+        /**
+         * @brief The precision of the time points, which is that of the fraction of a second (if any).
+         */
+        using duration = std::conditional_t<layout.width[uninttp_internals::tf_fraction] == 3, std::chrono::milliseconds,
+                         std::conditional_t<layout.width[uninttp_internals::tf_fraction] == 6, std::chrono::microseconds,
+                         std::conditional_t<layout.width[uninttp_internals::tf_fraction] == 9, std::chrono::nanoseconds, std::chrono::seconds>>>;
+
+        using time_point = std::chrono::sys_time<duration>;
+
+        /**
+         * @brief The number of characters that a timestamp takes up.
+         */
+        static constexpr std::size_t size = layout.size;
+
+        /**
+         * @brief Parses the timestamp at the start of `[first, last)`.
+         * @return The end of the timestamp, with `std::errc::invalid_argument` if it's cut short, malformed, or not a valid date and time (or,
+         *         in nanoseconds, one outside of 1677-09-21T00:12:43.145224192 to 2262-04-11T23:47:16.854775807, which they can't represent)
+         */
+        static std::from_chars_result parse(const char* const first, const char* const last, time_point& out) noexcept {
+            if (static_cast<std::size_t>(last - first) < size)
+                return { first, std::errc::invalid_argument };
+            const auto t = parse_unchecked(first);
+            if (!t.second)
+                return { first, std::errc::invalid_argument };
+            out = t.first;
+            return { first + size, std::errc{} };
+        }
+
+        /**
+         * @brief Parses `count` timestamps, the `i`th of which starts at `first + i * stride`, into `out` (e.g., a column of fixed-width records).
+         * @return The number of timestamps parsed before the first one that doesn't parse
+         */
+        static std::size_t parse(const char* const first, const std::size_t stride, const std::size_t count, time_point* const out) noexcept {
+            /* Blocks of rows are parsed without branching on their validity; only a block with a bad row is gone through again */
+            constexpr std::size_t block = 8;
+            for (std::size_t i = 0; i < count; i += block) {
+                const auto n = std::min(block, count - i);
+                auto ok = true;
+                for (std::size_t j = 0; j < n; j++) {
+                    const auto t = parse_unchecked(first + (i + j) * stride);
+                    out[i + j] = t.first;
+                    ok &= t.second;
+                }
+                if (!ok)
+                    for (std::size_t j = 0;; j++)
+                        if (!parse_unchecked(first + (i + j) * stride).second)
+                            return i + j;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Parses the `size` characters at `p` with no bounds check.
+         * @return The time point, and whether the characters were a valid timestamp (the time point is unspecified otherwise)
+         */
+        static std::pair<time_point, bool> parse_unchecked(const char* const p) noexcept {
+            const auto year = field<uninttp_internals::tf_year>(p, 1970), month = field<uninttp_internals::tf_month>(p, 1), day = field<uninttp_internals::tf_day>(p, 1);
+            const auto hour = field<uninttp_internals::tf_hour>(p, 0), minute = field<uninttp_internals::tf_minute>(p, 0), second = field<uninttp_internals::tf_second>(p, 0);
+            const auto leap = (year % 4 == 0) & ((year % 100 != 0) | (year % 400 == 0));
+            const auto last_day = 28 + ((uninttp_internals::tf_extra_days >> (month * 2 & 31)) & 3) + ((month == 2) & leap);
+            bool ok = uninttp_internals::tf_matches<Pattern>(p) & (month - 1 < 12) & (day - 1 < last_day) & (hour < 24) & (minute < 60) & (second < 60);
+            auto seconds = std::int64_t(uninttp_internals::tf_days_from_civil(static_cast<std::int32_t>(year), month, day)) * 86400 + hour * 3600 + minute * 60 + second;
+            auto fraction = static_cast<std::int64_t>(field<uninttp_internals::tf_fraction>(p, 0));
+            if constexpr (std::is_same_v<duration, std::chrono::nanoseconds>) {
+                /* 64 bits of nanoseconds only reach from 1677-09-21T00:12:43.145224192 to 2262-04-11T23:47:16.854775807 */
+                constexpr auto min = std::numeric_limits<std::int64_t>::min(), max = std::numeric_limits<std::int64_t>::max();
+                constexpr std::int64_t giga = 1'000'000'000;
+                const bool fits = (seconds >= min / giga && seconds < max / giga) | ((seconds == max / giga) & (fraction <= max % giga))
+                                | ((seconds == min / giga - 1) & (fraction >= min % giga + giga));
+                ok &= fits;
+                seconds = fits ? seconds : 0; // Keeps the conversion below from overflowing
+                const auto borrow = std::int64_t{ seconds < 0 && fraction > 0 }; // Likewise for the seconds alone at the lower limit
+                seconds += borrow;
+                fraction -= borrow * giga;
+            }
+            return { time_point { std::chrono::duration_cast<duration>(std::chrono::seconds { seconds }) + duration { fraction } }, ok };
+        }
+
+        /**
+         * @brief Writes `t` into `[first, last)`.
+         * @return The end of the timestamp, with `std::errc::value_too_large` if it doesn't fit or its year isn't within 0000-9999
+         */
+        static std::to_chars_result print(char* const first, char* const last, const time_point t) noexcept {
+            const auto days = std::chrono::floor<std::chrono::days>(t);
+            const auto date = uninttp_internals::tf_civil_from_days(static_cast<std::int32_t>(days.time_since_epoch().count()));
+            if (static_cast<std::size_t>(last - first) < size || date.year < 0 || date.year > 9999)
+                return { last, std::errc::value_too_large };
+            auto since_midnight = t.time_since_epoch() % std::chrono::days { 1 }; // Rather than `t - days`, which can overflow nanoseconds
+            if (since_midnight < duration::zero())
+                since_midnight += std::chrono::days { 1 };
+            const auto seconds = static_cast<std::uint32_t>(std::chrono::floor<std::chrono::seconds>(since_midnight).count());
+            std::memcpy(first, compiled::literal.data(), size);
+            put<uninttp_internals::tf_year>(first, static_cast<std::uint32_t>(date.year));
+            put<uninttp_internals::tf_month>(first, date.month);
+            put<uninttp_internals::tf_day>(first, date.day);
+            put<uninttp_internals::tf_hour>(first, seconds / 3600);
+            put<uninttp_internals::tf_minute>(first, seconds / 60 % 60);
+            put<uninttp_internals::tf_second>(first, seconds % 60);
+            put<uninttp_internals::tf_fraction>(first, static_cast<std::uint32_t>((since_midnight - std::chrono::seconds { seconds }).count()));
+            return { first + size, std::errc{} };
+        }
+    };
+}
+
+#endif /* UNINTTP_TIME_FORMAT_HPP */
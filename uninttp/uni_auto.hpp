@@ -44,6 +44,7 @@
 #include <iterator>
 #include <cstddef>
 #include <utility>
+#include <string_view>
 #include <format>
 #include <array>
 
@@ -60,6 +61,9 @@ namespace uninttp {
 
         template <typename T>
         struct is_uni_auto<uni_auto<T>> final : std::true_type {};
+
+        /* Not `constexpr` on purpose: a constant evaluation that reaches it fails, so the headers call it to reject malformed literals (with the reason in the diagnostic) at compile time */
+        inline void compile_time_error(const char*) noexcept {}
     }
 
     template <typename T, std::size_t N>
@@ -888,6 +892,17 @@ namespace uninttp {
     template <uni_auto Value>
     constexpr uni_auto_simplify_t<Value> uni_auto_simplify_v = Value;
 
+    /**
+     * @brief Views the character array held by a `uni_auto` object as an `std::basic_string_view` (excluding the trailing null terminator, if any).
+     * @tparam Value The `uni_auto` object
+     */
+    template <uni_auto Value>
+        requires std::is_array_v<std::remove_reference_t<uni_auto_t<Value>>>
+    constexpr std::basic_string_view<std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<uni_auto_t<Value>>>>> uni_auto_sv {
+        std::data(uni_auto_v<Value>),
+        std::size(uni_auto_v<Value>) - (std::size(uni_auto_v<Value>) > 0 && std::data(uni_auto_v<Value>)[std::size(uni_auto_v<Value>) - 1] == 0)
+    };
+
     /**
      * @brief Pre-constructs a `uni_auto` object after binding an lvalue to a reference.
      * @tparam Value The lvalue that the reference will bind to
@@ -939,6 +954,70 @@ namespace uninttp {
     constexpr auto to_array(const uni_auto<T>& a) noexcept {
         return std::to_array(a.value);
     }
+
+    /**
+     * @brief Creates a `uni_auto` object holding a built-in array using `a`.
+     */
+    template <typename T, std::size_t N>
+        requires (N > 0)
+    constexpr auto to_uni_auto(const std::array<T, N>& a) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            const T copy[N] { a[Indices]... };
+            return uni_auto<const T[N]>{ copy };
+        }(std::make_index_sequence<N>());
+    }
+
+    namespace uninttp_internals {
+        template <typename T>
+        using ua_element_t = std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<T>>>;
+
+        /* Arrays other than character arrays (which keep decaying to C strings) are formatted as ranges */
+        template <typename T>
+        concept ua_formattable_as_range = std::is_array_v<std::remove_reference_t<T>> && !std::is_same_v<ua_element_t<T>, char>;
+
+        /*
+         * Formats an array as `[a, b, c]` (or `a, b, c` given `n`), with the spec past a second `:` applied to every element by `Formatter`,
+         * i.e., the `std::range_formatter` syntax short of the fill, alignment and width of the whole range (and of quoting strings and characters).
+         */
+        template <typename Formatter>
+        struct ua_range_formatter {
+            Formatter element;
+            bool brackets = true;
+
+            template <typename ParseContext>
+            constexpr auto parse(ParseContext& c) {
+                auto it = c.begin();
+                if (it != c.end() && *it == 'n') {
+                    brackets = false;
+                    ++it;
+                }
+                if (it != c.end() && *it == ':')
+                    ++it;
+                else if (it != c.end() && *it != '}')
+                    return it; /* Leaves the spec unconsumed, which the caller reports */
+                c.advance_to(it);
+                return element.parse(c);
+            }
+
+            template <typename T, std::size_t N, typename FormatContext>
+            auto format(const T (&a)[N], FormatContext& c) const {
+                auto out = c.out();
+                if (brackets)
+                    *out++ = '[';
+                for (std::size_t i = 0; i < N; i++) {
+                    if (i > 0) {
+                        *out++ = ',';
+                        *out++ = ' ';
+                    }
+                    c.advance_to(out);
+                    out = element.format(a[i], c);
+                }
+                if (brackets)
+                    *out++ = ']';
+                return out;
+            }
+        };
+    }
 }
 
 template <typename T>
@@ -949,6 +1028,15 @@ struct std::formatter<uninttp::uni_auto<T>> : formatter<decay_t<T>> {
     }
 };
 
+template <typename T>
+    requires uninttp::uninttp_internals::ua_formattable_as_range<T>
+struct std::formatter<uninttp::uni_auto<T>> : uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>> {
+    template <typename FormatContext>
+    auto format(const uninttp::uni_auto<T>& a, FormatContext& c) const {
+        return uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>>::format(a.operator typename uninttp::uni_auto<T>::type(), c);
+    }
+};
+
 #ifdef FMT_EXPORT
     template <typename T>
     struct fmt::formatter<uninttp::uni_auto<T>> : formatter<std::decay_t<T>> {
@@ -957,6 +1045,15 @@ struct std::formatter<uninttp::uni_auto<T>> : formatter<decay_t<T>> {
             return formatter<std::decay_t<T>>::format(a.operator typename uninttp::uni_auto<T>::type(), c);
         }
     };
+
+    template <typename T>
+        requires uninttp::uninttp_internals::ua_formattable_as_range<T>
+    struct fmt::formatter<uninttp::uni_auto<T>> : uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>> {
+        template <typename FormatContext>
+        auto format(const uninttp::uni_auto<T>& a, FormatContext& c) const {
+            return uninttp::uninttp_internals::ua_range_formatter<formatter<uninttp::uninttp_internals::ua_element_t<T>>>::format(a.operator typename uninttp::uni_auto<T>::type(), c);
+        }
+    };
 #endif
 
 #endif /* UNINTTP_UNI_AUTO_HPP */
@@ -0,0 +1,199 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_UTF_HPP
+#define UNINTTP_UTF_HPP
+
+#include "uni_auto.hpp"
+#include <type_traits>
+#include <string_view>
+#include <cstddef>
+#include <array>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        template <typename T>
+        concept utf_char = std::is_same_v<T, char> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+        inline constexpr auto utf_invalid = char32_t{ 0xFFFFFFFF };
+
+        /* Decodes the code point at `s[i]` and advances `i` past it; gives `utf_invalid` for ill-formed input */
+        template <typename T>
+        constexpr char32_t utf_decode(const std::basic_string_view<T> s, std::size_t& i) noexcept {
+            const auto unit = [&](const std::size_t k) {
+                return static_cast<char32_t>(static_cast<std::make_unsigned_t<T>>(s[k]));
+            };
+            const auto c = unit(i++);
+            if constexpr (sizeof(T) == 1) {
+                if (c < 0x80)
+                    return c;
+                std::size_t extra = 0;
+                char32_t cp = 0, min = 0;
+                if ((c & 0xE0) == 0xC0) extra = 1, cp = c & 0x1F, min = 0x80;
+                else if ((c & 0xF0) == 0xE0) extra = 2, cp = c & 0x0F, min = 0x800;
+                else if ((c & 0xF8) == 0xF0) extra = 3, cp = c & 0x07, min = 0x10000;
+                else return utf_invalid;
+                for (; extra > 0; extra--) {
+                    if (i >= s.size() || (unit(i) & 0xC0) != 0x80)
+                        return utf_invalid;
+                    cp = (cp << 6) | (unit(i++) & 0x3F);
+                }
+                return cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF) ? utf_invalid : cp;
+            } else if constexpr (sizeof(T) == 2) {
+                if (c < 0xD800 || c > 0xDFFF)
+                    return c;
+                if (c > 0xDBFF || i >= s.size() || unit(i) < 0xDC00 || unit(i) > 0xDFFF)
+                    return utf_invalid;
+                return 0x10000 + ((c - 0xD800) << 10) + (unit(i++) - 0xDC00);
+            } else
+                return c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF) ? utf_invalid : c;
+        }
+
+        /* Encodes `cp` into `out + n` (if `out` isn't null); gives the number of code units */
+        template <typename T>
+        constexpr std::size_t utf_encode(const char32_t cp, T* out, const std::size_t n) noexcept {
+            const auto put = [&](const std::size_t k, const char32_t unit) {
+                if (out)
+                    out[n + k] = static_cast<T>(unit);
+            };
+            if constexpr (sizeof(T) == 1) {
+                if (cp < 0x80) {
+                    put(0, cp);
+                    return 1;
+                }
+                if (cp < 0x800) {
+                    put(0, 0xC0 | (cp >> 6));
+                    put(1, 0x80 | (cp & 0x3F));
+                    return 2;
+                }
+                if (cp < 0x10000) {
+                    put(0, 0xE0 | (cp >> 12));
+                    put(1, 0x80 | ((cp >> 6) & 0x3F));
+                    put(2, 0x80 | (cp & 0x3F));
+                    return 3;
+                }
+                put(0, 0xF0 | (cp >> 18));
+                put(1, 0x80 | ((cp >> 12) & 0x3F));
+                put(2, 0x80 | ((cp >> 6) & 0x3F));
+                put(3, 0x80 | (cp & 0x3F));
+                return 4;
+            } else if constexpr (sizeof(T) == 2) {
+                if (cp < 0x10000) {
+                    put(0, cp);
+                    return 1;
+                }
+                put(0, 0xD800 + ((cp - 0x10000) >> 10));
+                put(1, 0xDC00 + ((cp - 0x10000) & 0x3FF));
+                return 2;
+            } else {
+                put(0, cp);
+                return 1;
+            }
+        }
+
+        template <typename T>
+        constexpr bool utf_valid(const std::basic_string_view<T> s) noexcept {
+            for (std::size_t i = 0; i < s.size();)
+                if (utf_decode(s, i) == utf_invalid)
+                    return false;
+            return true;
+        }
+
+        /* Transcodes `s` into `out` (if any); gives the number of code units written, excluding the null terminator */
+        template <typename To, typename From>
+        constexpr auto utf_transcode(const std::basic_string_view<From> s, To* out) noexcept {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < s.size();) {
+                const auto cp = utf_decode(s, i);
+                if (cp == utf_invalid) {
+                    compile_time_error("ill-formed code unit sequence");
+                    return n;
+                }
+                n += utf_encode(cp, out, n);
+            }
+            return n;
+        }
+
+        template <typename To, std::size_t N, typename From>
+        constexpr auto utf_transcode(const std::basic_string_view<From> s) noexcept {
+            std::array<To, N> out{};
+            utf_transcode(s, out.data());
+            return out;
+        }
+
+        template <typename To, uni_auto Value>
+            requires utf_char<typename decltype(uni_auto_sv<Value>)::value_type>
+        constexpr auto utf_transcoded_v = to_uni_auto(utf_transcode<To, utf_transcode<To>(uni_auto_sv<Value>, static_cast<To*>(nullptr)) + 1>(uni_auto_sv<Value>));
+    }
+
+    /**
+     * @brief Transcodes a UTF-8 (`char`/`char8_t`), UTF-16 or UTF-32 string at compile time into a null-terminated UTF-8 `uni_auto` string of `char8_t`s.
+     * @tparam Value The `uni_auto` string to transcode (ill-formed input fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto utf8_v = uninttp_internals::utf_transcoded_v<char8_t, Value>;
+
+    /**
+     * @brief Transcodes a UTF-8 (`char`/`char8_t`), UTF-16 or UTF-32 string at compile time into a null-terminated UTF-16 `uni_auto` string.
+     * @tparam Value The `uni_auto` string to transcode (ill-formed input fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto utf16_v = uninttp_internals::utf_transcoded_v<char16_t, Value>;
+
+    /**
+     * @brief Transcodes a UTF-8 (`char`/`char8_t`), UTF-16 or UTF-32 string at compile time into a null-terminated UTF-32 `uni_auto` string.
+     * @tparam Value The `uni_auto` string to transcode (ill-formed input fails to compile)
+     */
+    template <uni_auto Value>
+    constexpr auto utf32_v = uninttp_internals::utf_transcoded_v<char32_t, Value>;
+
+    /**
+     * @brief Checks at compile time whether a UTF-8 (`char`/`char8_t`), UTF-16 or UTF-32 string is well-formed.
+     * @tparam Value The `uni_auto` string to check
+     */
+    template <uni_auto Value>
+        requires uninttp_internals::utf_char<typename decltype(uni_auto_sv<Value>)::value_type>
+    constexpr bool utf_valid_v = uninttp_internals::utf_valid(uni_auto_sv<Value>);
+
+    /**
+     * @brief Checks at compile time whether a `char`/`char8_t` string is well-formed UTF-8.
+     * @tparam Value The `uni_auto` string to check
+     */
+    template <uni_auto Value>
+        requires (sizeof(typename decltype(uni_auto_sv<Value>)::value_type) == 1)
+    constexpr bool utf8_valid_v = utf_valid_v<Value>;
+}
+
+#endif /* UNINTTP_UTF_HPP */
@@ -0,0 +1,378 @@
+/*
+ *               _       _   _
+ *              (_)     | | | |
+ *   _   _ _ __  _ _ __ | |_| |_ _ __
+ *  | | | | '_ \| | '_ \| __| __| '_ \
+ *  | |_| | | | | | | | | |_| |_| |_) |
+ *   \__,_|_| |_|_|_| |_|\__|\__| .__/
+ *                              | |
+ *                              |_|
+ *
+ * uninttp (Universal Non-Type Template Parameters)
+ *
+ * Version: v4.2.9
+ *
+ * Copyright (c) 2021-... reacfen
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNINTTP_WIRE_CODEC_HPP
+#define UNINTTP_WIRE_CODEC_HPP
+
+#include "uni_auto.hpp"
+#include "field.hpp"
+#include <system_error>
+#include <type_traits>
+#include <string_view>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <limits>
+#include <array>
+#include <bit>
+
+namespace uninttp {
+    namespace uninttp_internals {
+        enum class wire_type : std::uint8_t { varint = 0, fixed64 = 1, length_delimited = 2, fixed32 = 5 };
+
+        template <typename T>
+        concept wire_string = std::is_same_v<T, std::string_view> || (std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, char>);
+
+        template <typename T>
+        constexpr auto wire_type_of() noexcept {
+            if constexpr (wire_string<T>)
+                return wire_type::length_delimited;
+            else if constexpr (std::is_floating_point_v<T>) {
+                static_assert(sizeof(T) == 4 || sizeof(T) == 8, "wire_codec: floating-point members must be 32 or 64 bits wide");
+                return sizeof(T) == 4 ? wire_type::fixed32 : wire_type::fixed64;
+            } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+                static_assert(sizeof(T) <= 8, "wire_codec: integer members must be at most 64 bits wide");
+                return wire_type::varint;
+            } else
+                static_assert(!sizeof(T), "wire_codec: unsupported member type");
+        }
+
+        constexpr std::size_t wire_varint_size(const std::uint64_t v) noexcept {
+            return (static_cast<std::size_t>(std::bit_width(v | 1)) + 6) / 7;
+        }
+
+        /* Negative integers are sign-extended to 64 bits (and thus take up 10 bytes), like `int32` and `int64` do in Protocol Buffers */
+        template <typename T>
+        constexpr std::uint64_t wire_to_varint(const T v) noexcept {
+            if constexpr (std::is_enum_v<T>)
+                return wire_to_varint(static_cast<std::underlying_type_t<T>>(v));
+            else if constexpr (std::is_signed_v<T>)
+                return static_cast<std::uint64_t>(static_cast<std::int64_t>(v));
+            else
+                return static_cast<std::uint64_t>(v);
+        }
+
+        template <typename T>
+        constexpr T wire_from_varint(const std::uint64_t v) noexcept {
+            if constexpr (std::is_same_v<T, bool>)
+                return v != 0;
+            else if constexpr (std::is_enum_v<T>)
+                return static_cast<T>(wire_from_varint<std::underlying_type_t<T>>(v));
+            else
+                return static_cast<T>(v);
+        }
+
+        /* Gives the most bytes that a value of type `T` can take up (without its tag), or 0 if that isn't bounded */
+        template <typename T>
+        constexpr std::size_t wire_max_size() noexcept {
+            if constexpr (wire_type_of<T>() == wire_type::fixed32)
+                return 4;
+            else if constexpr (wire_type_of<T>() == wire_type::fixed64)
+                return 8;
+            else if constexpr (wire_type_of<T>() == wire_type::varint)
+                return wire_varint_size(wire_to_varint(std::is_signed_v<T> || std::is_enum_v<T> ? T(-1) : std::numeric_limits<T>::max()));
+            else
+                return 0;
+        }
+
+        /* The tag of a field, already encoded as a varint */
+        template <std::uint32_t Number, wire_type Type>
+        constexpr auto wire_tag = [] {
+            constexpr auto tag = static_cast<std::uint64_t>(Number) << 3 | static_cast<std::uint64_t>(Type);
+            std::array<std::byte, wire_varint_size(tag)> out{};
+            for (std::size_t i = 0; i < out.size(); i++)
+                out[i] = static_cast<std::byte>((tag >> (7 * i) & 0x7F) | (i + 1 < out.size() ? 0x80 : 0));
+            return out;
+        }();
+
+        inline std::byte* wire_put_varint(std::byte* p, std::uint64_t v) noexcept {
+            for (; v >= 0x80; v >>= 7)
+                *p++ = static_cast<std::byte>(v | 0x80);
+            *p++ = static_cast<std::byte>(v);
+            return p;
+        }
+
+        /* Stores or loads a fixed-width value in little-endian byte order */
+        template <typename T>
+        void wire_copy_fixed(std::byte* const dst, const std::byte* const src) noexcept {
+            if constexpr (std::endian::native == std::endian::little)
+                std::memcpy(dst, src, sizeof(T));
+            else
+                std::reverse_copy(src, src + sizeof(T), dst);
+        }
+
+        /* Reads wire-format values from `[p, last)`; on failure, `ec` tells why */
+        struct wire_cursor final {
+            const std::byte* p;
+            const std::byte* last;
+            std::errc ec{};
+
+            auto fail(const std::errc e = std::errc::invalid_argument) noexcept {
+                ec = e;
+                return false;
+            }
+
+            auto varint(std::uint64_t& out) noexcept {
+                if (p != last && (*p & std::byte{ 0x80 }) == std::byte{}) {
+                    out = std::to_integer<std::uint64_t>(*p++);
+                    return true;
+                }
+                out = 0;
+                for (auto shift = 0; shift < 64; shift += 7) {
+                    if (p == last)
+                        return fail();
+                    const auto b = std::to_integer<std::uint64_t>(*p++);
+                    out |= (b & 0x7F) << shift;
+                    if (b < 0x80)
+                        return true;
+                }
+                return fail();
+            }
+
+            auto length(std::string_view& out) noexcept {
+                std::uint64_t n;
+                if (!varint(n))
+                    return false;
+                if (n > static_cast<std::uint64_t>(last - p))
+                    return fail();
+                out = { reinterpret_cast<const char*>(p), static_cast<std::size_t>(n) };
+                p += n;
+                return true;
+            }
+
+            auto skip(const std::uint64_t type) noexcept {
+                std::uint64_t unused;
+                std::string_view bytes;
+                switch (type) {
+                    case static_cast<std::uint64_t>(wire_type::varint):
+                        return varint(unused);
+                    case static_cast<std::uint64_t>(wire_type::length_delimited):
+                        return length(bytes);
+                    case static_cast<std::uint64_t>(wire_type::fixed64):
+                    case static_cast<std::uint64_t>(wire_type::fixed32): {
+                        const auto n = type == static_cast<std::uint64_t>(wire_type::fixed64) ? 8 : 4;
+                        if (last - p < n)
+                            return fail();
+                        p += n;
+                        return true;
+                    }
+                    default:
+                        return fail(); // Groups are not supported
+                }
+            }
+
+            template <typename T>
+            auto value(T& out) noexcept {
+                if constexpr (wire_type_of<T>() == wire_type::varint) {
+                    std::uint64_t v;
+                    if (!varint(v))
+                        return false;
+                    out = wire_from_varint<T>(v);
+                    return true;
+                } else if constexpr (wire_type_of<T>() == wire_type::length_delimited) {
+                    std::string_view s;
+                    if (!length(s))
+                        return false;
+                    if constexpr (std::is_array_v<T>) {
+                        if (s.size() >= std::extent_v<T>)
+                            return fail(std::errc::value_too_large);
+                        std::memcpy(out, s.data(), s.size());
+                        out[s.size()] = '\0';
+                    } else
+                        out = s;
+                    return true;
+                } else {
+                    if (static_cast<std::size_t>(last - p) < sizeof(T))
+                        return fail();
+                    wire_copy_fixed<T>(reinterpret_cast<std::byte*>(&out), p);
+                    p += sizeof(T);
+                    return true;
+                }
+            }
+        };
+    }
+
+    /**
+     * @brief An encoder and decoder for a subset of the Protocol Buffers wire format, whose tags get encoded at compile time.
+     *
+     * Fields are keyed by their field numbers. `bool`s, integers and enumerations are encoded as varints (negative values take up
+     * 10 bytes, like `int32`/`int64` do), `float`s and `double`s as `fixed32`/`fixed64`, and `std::string_view`s and `char` arrays
+     * (holding null-terminated strings) as length-delimited fields. As in proto3, fields holding zero or the empty string are left out.
+     *
+     * @tparam Fields The `field`s describing the members to encode, keyed by their field numbers
+     */
+    template <field_type... Fields>
+        requires (sizeof...(Fields) > 0 && (std::is_integral_v<uni_auto_simplify_t<Fields::key>> && ...))
+    struct wire_codec final {
+    private:
+        using class_type = fields_class_t<Fields...>;
+
+        template <typename Field>
+        using member_t = std::remove_cvref_t<typename Field::value_type>;
+
+        template <typename Field>
+        static constexpr auto type = uninttp_internals::wire_type_of<member_t<Field>>();
+
+        template <typename Field>
+        static constexpr auto number = static_cast<std::uint32_t>(uni_auto_simplify_v<Field::key>);
+
+        static_assert(((uni_auto_simplify_v<Fields::key> >= 1 && uni_auto_simplify_v<Fields::key> < (1 << 29)) && ...), "wire_codec: field numbers must be within [1, 2^29)");
+        static_assert(((uni_auto_simplify_v<Fields::key> < 19000 || uni_auto_simplify_v<Fields::key> > 19999) && ...), "wire_codec: field numbers 19000 through 19999 are reserved");
+        static_assert([] {
+            std::array<std::uint32_t, sizeof...(Fields)> numbers { number<Fields>... };
+            std::sort(numbers.begin(), numbers.end());
+            return std::adjacent_find(numbers.begin(), numbers.end()) == numbers.end();
+        }(), "wire_codec: field numbers must be unique");
+
+        static constexpr std::array<std::uint64_t, sizeof...(Fields)> tags { (static_cast<std::uint64_t>(number<Fields>) << 3 | static_cast<std::uint64_t>(type<Fields>))... };
+
+        static constexpr auto bounded = ((uninttp_internals::wire_max_size<member_t<Fields>>() > 0) && ...);
+
+        template <typename Field>
+        static constexpr auto text(const class_type& msg) noexcept {
+            if constexpr (std::is_array_v<member_t<Field>>)
+                return std::string_view { Field::get(msg) };
+            else
+                return Field::get(msg);
+        }
+
+        template <typename Field>
+        static constexpr auto empty(const class_type& msg) noexcept {
+            if constexpr (type<Field> == uninttp_internals::wire_type::length_delimited)
+                return text<Field>(msg).empty();
+            else
+                return Field::get(msg) == member_t<Field>{};
+        }
+
+        template <typename Field>
+        static constexpr std::size_t field_size(const class_type& msg) noexcept {
+            if (empty<Field>(msg))
+                return 0;
+            constexpr auto tag_size = uninttp_internals::wire_tag<number<Field>, type<Field>>.size();
+            if constexpr (type<Field> == uninttp_internals::wire_type::varint)
+                return tag_size + uninttp_internals::wire_varint_size(uninttp_internals::wire_to_varint(Field::get(msg)));
+            else if constexpr (type<Field> == uninttp_internals::wire_type::length_delimited)
+                return tag_size + uninttp_internals::wire_varint_size(text<Field>(msg).size()) + text<Field>(msg).size();
+            else
+                return tag_size + sizeof(member_t<Field>);
+        }
+
+        template <typename Field>
+        static auto put(std::byte* p, const class_type& msg) noexcept {
+            if (empty<Field>(msg))
+                return p;
+            constexpr auto& tag = uninttp_internals::wire_tag<number<Field>, type<Field>>;
+            std::memcpy(p, tag.data(), tag.size());
+            p += tag.size();
+            if constexpr (type<Field> == uninttp_internals::wire_type::varint)
+                return uninttp_internals::wire_put_varint(p, uninttp_internals::wire_to_varint(Field::get(msg)));
+            else if constexpr (type<Field> == uninttp_internals::wire_type::length_delimited) {
+                const auto s = text<Field>(msg);
+                p = uninttp_internals::wire_put_varint(p, s.size());
+                std::memcpy(p, s.data(), s.size());
+                return p + s.size();
+            } else {
+                uninttp_internals::wire_copy_fixed<member_t<Field>>(p, reinterpret_cast<const std::byte*>(&Field::get(msg)));
+                return p + sizeof(member_t<Field>);
+            }
+        }
+
+        template <typename Field>
+        static bool member(uninttp_internals::wire_cursor& c, class_type& msg) noexcept {
+            return c.value(Field::get(msg));
+        }
+
+        static constexpr bool (*members[])(uninttp_internals::wire_cursor&, class_type&) noexcept { &member<Fields>... };
+
+    public:
+        /**
+         * @brief The most bytes that a message can take up, or 0 if some field (e.g., a string) isn't bounded.
+         */
+        static constexpr std::size_t max_size = bounded ? (0 + ... + (uninttp_internals::wire_tag<number<Fields>, type<Fields>>.size() + uninttp_internals::wire_max_size<member_t<Fields>>())) : 0;
+
+        /**
+         * @brief Returns the number of bytes that `msg` gets encoded into.
+         */
+        static constexpr std::size_t encoded_size(const class_type& msg) noexcept {
+            return (0 + ... + field_size<Fields>(msg));
+        }
+
+        /**
+         * @brief Encodes `msg` into `[first, last)`.
+         * @return The end of the encoded message, or `nullptr` if it didn't fit
+         */
+        static std::byte* encode(std::byte* const first, std::byte* const last, const class_type& msg) noexcept {
+            if (!(bounded && static_cast<std::size_t>(last - first) >= max_size) && static_cast<std::size_t>(last - first) < encoded_size(msg))
+                return nullptr;
+            auto p = first;
+            ((p = put<Fields>(p, msg)), ...);
+            return p;
+        }
+
+        /**
+         * @brief Decodes the message in `[first, last)` into `msg`.
+         *
+         * Fields that are absent keep their values, and fields with unknown numbers are skipped; `std::string_view` members refer to the input.
+         *
+         * @return `std::errc{}` on success, `std::errc::invalid_argument` if the input is malformed or a field has an unexpected wire
+         * type, or `std::errc::value_too_large` if a string doesn't fit its `char` array
+         */
+        static std::errc decode(const std::byte* const first, const std::byte* const last, class_type& msg) noexcept {
+            uninttp_internals::wire_cursor c { first, last };
+            std::size_t expected = 0;
+            while (c.p != c.last) {
+                std::uint64_t tag;
+                if (!c.varint(tag))
+                    return c.ec;
+                auto i = expected < tags.size() && tags[expected] == tag ? expected : std::find(tags.begin(), tags.end(), tag) - tags.begin();
+                if (static_cast<std::size_t>(i) == tags.size()) {
+                    if (std::find_if(tags.begin(), tags.end(), [&](const auto t) { return t >> 3 == tag >> 3; }) != tags.end() || tag >> 3 == 0)
+                        return std::errc::invalid_argument;
+                    if (!c.skip(tag & 7))
+                        return c.ec;
+                    continue;
+                }
+                if (!members[i](c, msg))
+                    return c.ec;
+                expected = static_cast<std::size_t>(i) + 1;
+            }
+            return {};
+        }
+    };
+}
+
+#endif /* UNINTTP_WIRE_CODEC_HPP */